@@ -0,0 +1,494 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_ALGORITHM_HPP
+#define FT_CONTAINERS_FINAL_ALGORITHM_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+#include <algorithm>
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+//Sorting over random access ranges: ft::vector iterators, pointers...
+//sort is an introsort, stable_sort a merge sort with an n / 2 element buffer,
+//partial_sort a heap select, radix_sort an LSD radix sort on integral
+//or floating point keys. make_heap, push_heap, pop_heap and sort_heap work
+//on binary heaps, ft::dary_heap on heaps of any arity.
+namespace ft {
+//Ranges this short are left to insertion sort.
+const ptrdiff_t sort_threshold = 16;
+
+template<typename T>
+struct less {
+	bool operator()(const T &a, const T &b) const { return a < b; }
+};
+
+//Utils:
+template<typename RandomIt>
+void sort_swap(RandomIt a, RandomIt b) {
+	using std::swap;
+
+	swap(*a, *b);
+}
+
+template<typename RandomIt, typename Comp>
+void insertion_sort(RandomIt first, RandomIt last, Comp &comp) {
+	typedef typename iterator_traits<RandomIt>::value_type T;
+
+	if (first == last)
+		return;
+	for (RandomIt it = first + 1; it != last; ++it) {
+		T val = *it;
+		RandomIt hole = it;
+		if (comp(val, *first)) {
+			for (; hole != first; --hole)
+				*hole = *(hole - 1);
+		} else {
+			//*first is a sentinel: no bound check in the loop.
+			for (; comp(val, *(hole - 1)); --hole)
+				*hole = *(hole - 1);
+		}
+		*hole = val;
+	}
+}
+
+//Heap:
+//ft::dary_heap: max-heap operations on [first, last) where the children of
+//i are D * i + 1 ... D * i + D. A bigger D makes the heap shallower and
+//puts the children of a node in one or two cache lines, for more
+//comparisons per level. The free make_heap, push_heap, pop_heap and
+//sort_heap are the binary ones.
+template<size_t D>
+struct dary_heap {
+	//Moves the hole at pos down to a leaf along the larger children, then
+	//val up from there: pops mostly bring a small value back from the
+	//bottom, so this saves a comparison per level. Returns where val went.
+	template<typename RandomIt, typename T, typename Comp>
+	static ptrdiff_t sift_down(RandomIt first, ptrdiff_t pos, ptrdiff_t len,
+							   const T &val, Comp &comp) {
+		ptrdiff_t top = pos;
+		ptrdiff_t child;
+
+		while ((child = D * pos + 1) < len) {
+			ptrdiff_t end = child + static_cast<ptrdiff_t>(D) < len
+							? child + static_cast<ptrdiff_t>(D) : len;
+			for (ptrdiff_t c = child + 1; c < end; c++)
+				if (comp(first[child], first[c]))
+					child = c;
+			first[pos] = first[child];
+			pos = child;
+		}
+		return sift_up(first, pos, top, val, comp);
+	}
+
+	//Moves val from the hole at pos up while its parent is smaller, not
+	//past top. Returns where val went.
+	template<typename RandomIt, typename T, typename Comp>
+	static ptrdiff_t sift_up(RandomIt first, ptrdiff_t pos, ptrdiff_t top,
+							 const T &val, Comp &comp) {
+		ptrdiff_t parent;
+
+		while (pos > top && comp(first[parent = (pos - 1) / D], val)) {
+			first[pos] = first[parent];
+			pos = parent;
+		}
+		first[pos] = val;
+		return pos;
+	}
+
+	//Floyd's construction, O(n).
+	template<typename RandomIt, typename Comp>
+	static void make(RandomIt first, RandomIt last, Comp &comp) {
+		typedef typename iterator_traits<RandomIt>::value_type T;
+		ptrdiff_t len = last - first;
+
+		if (len < 2)
+			return;
+		for (ptrdiff_t i = (len - 2) / static_cast<ptrdiff_t>(D); i >= 0; i--) {
+			T val = first[i];
+			sift_down(first, i, len, val, comp);
+		}
+	}
+
+	//[first, last - 1) is a heap, adds last[-1] to it.
+	template<typename RandomIt, typename Comp>
+	static void push(RandomIt first, RandomIt last, Comp &comp) {
+		typedef typename iterator_traits<RandomIt>::value_type T;
+		T val = *(last - 1);
+
+		sift_up(first, last - first - 1, 0, val, comp);
+	}
+
+	//Moves the largest element to last[-1], [first, last - 1) stays a heap.
+	template<typename RandomIt, typename Comp>
+	static void pop(RandomIt first, RandomIt last, Comp &comp) {
+		typedef typename iterator_traits<RandomIt>::value_type T;
+		ptrdiff_t len = last - first;
+
+		if (len < 2)
+			return;
+		T val = first[len - 1];
+		first[len - 1] = first[0];
+		sift_down(first, 0, len - 1, val, comp);
+	}
+
+	template<typename RandomIt, typename Comp>
+	static void sort(RandomIt first, RandomIt last, Comp &comp) {
+		for (; last - first > 1; --last)
+			pop(first, last, comp);
+	}
+};
+
+template<typename RandomIt, typename Comp>
+void make_heap(RandomIt first, RandomIt last, Comp comp) {
+	dary_heap<2>::make(first, last, comp);
+}
+
+template<typename RandomIt>
+void make_heap(RandomIt first, RandomIt last) {
+	ft::make_heap(first, last,
+				  less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+template<typename RandomIt, typename Comp>
+void push_heap(RandomIt first, RandomIt last, Comp comp) {
+	dary_heap<2>::push(first, last, comp);
+}
+
+template<typename RandomIt>
+void push_heap(RandomIt first, RandomIt last) {
+	ft::push_heap(first, last,
+				  less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+template<typename RandomIt, typename Comp>
+void pop_heap(RandomIt first, RandomIt last, Comp comp) {
+	dary_heap<2>::pop(first, last, comp);
+}
+
+template<typename RandomIt>
+void pop_heap(RandomIt first, RandomIt last) {
+	ft::pop_heap(first, last,
+				 less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+template<typename RandomIt, typename Comp>
+void sort_heap(RandomIt first, RandomIt last, Comp comp) {
+	dary_heap<2>::sort(first, last, comp);
+}
+
+template<typename RandomIt>
+void sort_heap(RandomIt first, RandomIt last) {
+	ft::sort_heap(first, last,
+				  less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+//Introsort:
+template<typename RandomIt, typename Comp>
+void median_to_first(RandomIt first, RandomIt a, RandomIt b, RandomIt c,
+					 Comp &comp) {
+	if (comp(*a, *b)) {
+		if (comp(*b, *c))
+			sort_swap(first, b);
+		else if (comp(*a, *c))
+			sort_swap(first, c);
+		else
+			sort_swap(first, a);
+	} else if (comp(*a, *c))
+		sort_swap(first, a);
+	else if (comp(*b, *c))
+		sort_swap(first, c);
+	else
+		sort_swap(first, b);
+}
+
+//Partitions [first + 1, last) around the pivot *first. The median of
+//three leaves an element on each side that stops the scans.
+template<typename RandomIt, typename Comp>
+RandomIt partition_pivot(RandomIt first, RandomIt last, Comp &comp) {
+	RandomIt lo = first + 1;
+	RandomIt hi = last;
+
+	median_to_first(first, lo, first + (last - first) / 2, last - 1, comp);
+	for (;;) {
+		while (comp(*lo, *first))
+			++lo;
+		--hi;
+		while (comp(*first, *hi))
+			--hi;
+		if (!(lo < hi))
+			return lo;
+		sort_swap(lo, hi);
+		++lo;
+	}
+}
+
+//Quicksort until the ranges are below sort_threshold, heap sort once
+//depth runs out, so the worst case stays O(n log n).
+template<typename RandomIt, typename Comp>
+void introsort_loop(RandomIt first, RandomIt last, size_t depth, Comp &comp) {
+	while (last - first > sort_threshold) {
+		if (depth == 0) {
+			ft::make_heap(first, last, comp);
+			ft::sort_heap(first, last, comp);
+			return;
+		}
+		depth--;
+		RandomIt cut = partition_pivot(first, last, comp);
+		introsort_loop(cut, last, depth, comp);
+		last = cut;
+	}
+}
+
+template<typename RandomIt, typename Comp>
+void sort(RandomIt first, RandomIt last, Comp comp) {
+	size_t depth = 0;
+
+	for (ptrdiff_t n = last - first; n > 1; n >>= 1)
+		depth += 2;
+	introsort_loop(first, last, depth, comp);
+	insertion_sort(first, last, comp);
+}
+
+template<typename RandomIt>
+void sort(RandomIt first, RandomIt last) {
+	ft::sort(first, last,
+			 less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+//Stable:
+//Stable merge of a[0, na) and b[0, nb) into out.
+template<typename It1, typename It2, typename OutputIt, typename Comp>
+void merge_into(It1 a, size_t na, It2 b, size_t nb, OutputIt out,
+				Comp &comp) {
+	It1 ea = a + na;
+	It2 eb = b + nb;
+
+	while (a != ea && b != eb) {
+		if (comp(*b, *a))
+			*out++ = *b++;
+		else
+			*out++ = *a++;
+	}
+	while (a != ea)
+		*out++ = *a++;
+	while (b != eb)
+		*out++ = *b++;
+}
+
+//Merge sort of first[0, n), buf holds (n + 1) / 2 elements of scratch.
+template<typename RandomIt, typename T, typename Comp>
+void merge_sort(RandomIt first, size_t n, T *buf, Comp &comp) {
+	size_t h = n / 2;
+
+	if (n <= static_cast<size_t>(sort_threshold)) {
+		insertion_sort(first, first + n, comp);
+		return;
+	}
+	merge_sort(first, h, buf, comp);
+	merge_sort(first + h, n - h, buf, comp);
+	if (!comp(first[h], first[h - 1]))
+		return;
+	for (size_t i = 0; i < h; i++)
+		buf[i] = first[i];
+	merge_into(buf, h, first + h, n - h, first, comp);
+}
+
+template<typename RandomIt, typename Comp>
+void stable_sort(RandomIt first, RandomIt last, Comp comp) {
+	typedef typename iterator_traits<RandomIt>::value_type T;
+
+	if (last - first <= sort_threshold) {
+		insertion_sort(first, last, comp);
+		return;
+	}
+	vector<T> buf(first, first + (last - first + 1) / 2);
+	merge_sort(first, last - first, &buf[0], comp);
+}
+
+template<typename RandomIt>
+void stable_sort(RandomIt first, RandomIt last) {
+	ft::stable_sort(first, last,
+					less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+//Partial:
+//Sorts the middle - first smallest elements into [first, middle), the
+//rest is left in unspecified order.
+template<typename RandomIt, typename Comp>
+void partial_sort(RandomIt first, RandomIt middle, RandomIt last,
+				  Comp comp) {
+	typedef typename iterator_traits<RandomIt>::value_type T;
+	ptrdiff_t len = middle - first;
+
+	if (len == 0)
+		return;
+	ft::make_heap(first, middle, comp);
+	for (RandomIt it = middle; it != last; ++it) {
+		if (comp(*it, *first)) {
+			T val = *it;
+			*it = *first;
+			dary_heap<2>::sift_down(first, 0, len, val, comp);
+		}
+	}
+	ft::sort_heap(first, middle, comp);
+}
+
+template<typename RandomIt>
+void partial_sort(RandomIt first, RandomIt middle, RandomIt last) {
+	ft::partial_sort(first, middle, last,
+					 less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+//Radix:
+//ft::radix_key: maps a key to an unsigned integer of the same size that
+//orders the same way. Signed integers get their sign bit flipped, floats
+//all their bits when negative and the sign bit otherwise.
+template<size_t Size>
+struct radix_bits;
+
+template<>
+struct radix_bits<1> {typedef uint8_t type;};
+
+template<>
+struct radix_bits<2> {typedef uint16_t type;};
+
+template<>
+struct radix_bits<4> {typedef uint32_t type;};
+
+template<>
+struct radix_bits<8> {typedef uint64_t type;};
+
+template<typename K, bool Integral = is_integral<K>::value>
+struct radix_key {
+	typedef typename radix_bits<sizeof(K)>::type type;
+
+	static type get(const K &k) {
+		const type sign = type(1) << (sizeof(K) * 8 - 1);
+
+		return static_cast<type>(k) ^ (K(-1) < K(0) ? sign : type(0));
+	}
+};
+
+template<typename K>
+struct radix_key<K, false> {
+	typedef typename enable_if<is_same<K, float>::value
+							   || is_same<K, double>::value,
+			typename radix_bits<sizeof(K)>::type>::type type;
+
+	static type get(const K &k) {
+		const type sign = type(1) << (sizeof(K) * 8 - 1);
+		type bits;
+
+		std::memcpy(&bits, &k, sizeof(K));
+		return bits & sign ? type(~bits) : type(bits | sign);
+	}
+};
+
+//ft::key_result: what a key extractor returns. Functors name it with a
+//result_type typedef like std::unary_function does.
+template<typename Function>
+struct key_result {typedef typename Function::result_type type;};
+
+template<typename R, typename A>
+struct key_result<R (*)(A)> {typedef R type;};
+
+template<typename T>
+struct identity_key {
+	typedef T result_type;
+
+	const T &operator()(const T &x) const { return x; }
+};
+
+//A key already mapped by radix_key and the position of its element.
+template<typename U>
+struct radix_item {
+	typedef U result_type;
+
+	U key;
+	size_t index;
+
+	U operator()(const radix_item &x) const { return x.key; }
+};
+
+//Sorts src[0, n) by key, dst is a buffer of n elements. One pass per byte
+//of the key, a pass is skipped when all keys share that byte. Returns
+//whichever of src and dst the result ended up in.
+template<typename T, typename KeyFn>
+T *radix_passes(T *src, T *dst, size_t n, KeyFn key) {
+	typedef radix_key<typename remove_const<
+			typename key_result<KeyFn>::type>::type> rk;
+	typedef typename rk::type U;
+	const size_t passes = sizeof(U);
+	size_t count[sizeof(U)][256];
+
+	std::memset(count, 0, sizeof(count));
+	for (size_t i = 0; i < n; i++) {
+		U k = rk::get(key(src[i]));
+		for (size_t p = 0; p < passes; p++)
+			count[p][(k >> (8 * p)) & 0xFF]++;
+	}
+	for (size_t p = 0; p < passes; p++) {
+		size_t offset = 0;
+		if (count[p][(rk::get(key(src[0])) >> (8 * p)) & 0xFF] == n)
+			continue;
+		for (size_t d = 0; d < 256; d++) {
+			size_t c = count[p][d];
+			count[p][d] = offset;
+			offset += c;
+		}
+		for (size_t i = 0; i < n; i++)
+			dst[count[p][(rk::get(key(src[i])) >> (8 * p)) & 0xFF]++] = src[i];
+		T *tmp = src;
+		src = dst;
+		dst = tmp;
+	}
+	return src;
+}
+
+//Stable. Elements up to twice the size of a key move in every pass.
+//Bigger records are ranked through (key, index) pairs and then moved
+//once.
+template<typename RandomIt, typename KeyFn>
+void radix_sort(RandomIt first, RandomIt last, KeyFn key) {
+	typedef typename iterator_traits<RandomIt>::value_type T;
+	typedef radix_key<typename remove_const<
+			typename key_result<KeyFn>::type>::type> rk;
+	typedef radix_item<typename rk::type> item;
+	size_t n = last - first;
+
+	if (n < 2)
+		return;
+	if (sizeof(T) <= 2 * sizeof(typename rk::type)) {
+		vector<T> a(first, last);
+		vector<T> b(a);
+		T *sorted = radix_passes(&a[0], &b[0], n, key);
+		for (size_t i = 0; i < n; i++, ++first)
+			*first = sorted[i];
+		return;
+	}
+	vector<item> a(n);
+	vector<item> b(n);
+	for (size_t i = 0; i < n; i++) {
+		a[i].key = rk::get(key(first[i]));
+		a[i].index = i;
+	}
+	item *sorted = radix_passes(&a[0], &b[0], n, item());
+	vector<T> copy(first, last);
+	for (size_t i = 0; i < n; i++, ++first)
+		*first = copy[sorted[i].index];
+}
+
+template<typename RandomIt>
+void radix_sort(RandomIt first, RandomIt last) {
+	ft::radix_sort(first, last,
+			identity_key<typename iterator_traits<RandomIt>::value_type>());
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_ALGORITHM_HPP
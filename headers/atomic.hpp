@@ -0,0 +1,64 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_ATOMIC_HPP
+#define FT_CONTAINERS_FINAL_ATOMIC_HPP
+
+#include <cstddef>
+#include <sched.h>
+
+//Helpers for the concurrent containers. They use the GCC __atomic
+//builtins, which also work in C++98 (gcc, clang, icc).
+namespace ft {
+//Hot indices written by different threads are kept this far apart.
+static const size_t cache_line = 64;
+
+//Tells the CPU it is in a spin loop.
+inline void cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_ia32_pause();
+#elif defined(__aarch64__)
+	__asm__ __volatile__("yield");
+#else
+	__atomic_signal_fence(__ATOMIC_SEQ_CST);
+#endif
+}
+
+//ft::backoff: exponential spinning after a failed CAS, up to limit
+//pauses, then the thread yields its time slice.
+class backoff {
+	unsigned int spins;
+	unsigned int limit;
+
+public:
+	explicit backoff(unsigned int _limit = 1024): spins(1), limit(_limit) {}
+
+	void operator()(void) {
+		if (spins > limit) {
+			sched_yield();
+			return;
+		}
+		for (unsigned int i = 0; i < spins; i++)
+			cpu_relax();
+		spins <<= 1;
+	}
+
+	void reset(void) { spins = 1; }
+};
+
+//A thread local xorshift generator, to spread threads over slots.
+inline unsigned int thread_random(void) {
+	static __thread unsigned int state = 0;
+
+	if (state == 0)
+		state = static_cast<unsigned int>(
+				reinterpret_cast<size_t>(&state) >> 4) | 1u;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_ATOMIC_HPP
@@ -0,0 +1,503 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_COMPRESSED_VECTOR_HPP
+#define FT_CONTAINERS_FINAL_COMPRESSED_VECTOR_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <cstdio>
+#include <stdint.h>
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+namespace ft {
+//Bit-packing helpers for ft::compressed_vector.
+//A packed block holds block values of W bits spread over lanes 64-bit
+//lanes: value i is slot i / lanes of lane i % lanes, and word k of a lane
+//is word k * lanes + lane. Every lane is unpacked with the same shifts, so
+//the four lanes of a row turn into vector instructions.
+namespace packing {
+const size_t lanes = 4;
+const size_t block = 128;
+const size_t rows = block / lanes;
+
+//Words taken by a block of W-bit values.
+inline size_t words(unsigned w) { return lanes * ((rows * w + 63) / 64); }
+
+template<int W>
+struct mask {static const uint64_t value = ~uint64_t(0) >> (64 - W);};
+
+template<int W, int Row>
+struct unpack_row {
+	static void lane(const uint64_t *in, uint64_t *out, unsigned s) {
+		uint64_t v = in[0] >> s;
+
+		if (s + W > 64)
+			v |= in[lanes] << ((64 - s) % 64);
+		*out = v & mask<W>::value;
+	}
+
+	//W and Row are constants, so all shifts are.
+	static void run(const uint64_t *in, uint64_t *out) {
+		const unsigned k = Row * W / 64;
+		const unsigned s = Row * W % 64;
+
+		lane(in + k * lanes, out + Row * lanes, s);
+		lane(in + k * lanes + 1, out + Row * lanes + 1, s);
+		lane(in + k * lanes + 2, out + Row * lanes + 2, s);
+		lane(in + k * lanes + 3, out + Row * lanes + 3, s);
+		unpack_row<W, Row + 1>::run(in, out);
+	}
+};
+
+template<int W>
+struct unpack_row<W, rows> {
+	static void run(const uint64_t *, uint64_t *) {}
+};
+
+//Unpacks the block values of width W.
+template<int W>
+void unpack(const uint64_t *in, uint64_t *out) {
+	unpack_row<W, 0>::run(in, out);
+}
+
+//Width 0: all values are 0 and nothing is stored.
+template<>
+inline void unpack<0>(const uint64_t *, uint64_t *out) {
+	for (size_t i = 0; i < block; i++)
+		out[i] = 0;
+}
+
+typedef void (*unpack_fn)(const uint64_t *, uint64_t *);
+
+template<int W>
+struct unpack_table {
+	static void fill(unpack_fn *table) {
+		table[W] = &unpack<W>;
+		unpack_table<W - 1>::fill(table);
+	}
+};
+
+template<>
+struct unpack_table<-1> {
+	static void fill(unpack_fn *) {}
+};
+
+//unpack<W> for a width only known at run time.
+struct unpacker {
+	unpack_fn table[65];
+
+	unpacker(void) { unpack_table<64>::fill(table); }
+
+	static const unpacker &get(void) {
+		static const unpacker instance;
+
+		return instance;
+	}
+};
+
+//Packs block values of width w, out has to be zeroed.
+inline void pack(const uint64_t *in, uint64_t *out, unsigned w) {
+	for (size_t i = 0; w && i < block; i++) {
+		size_t bit = i / lanes * w;
+		size_t k = (bit >> 6) * lanes + i % lanes;
+		unsigned s = bit & 63;
+
+		out[k] |= in[i] << s;
+		if (s + w > 64)
+			out[k + lanes] |= in[i] >> (64 - s);
+	}
+}
+
+//Value i of a block packed at width w.
+inline uint64_t get(const uint64_t *in, size_t i, unsigned w) {
+	size_t bit = i / lanes * w;
+	size_t k = (bit >> 6) * lanes + i % lanes;
+	unsigned s = bit & 63;
+	uint64_t v;
+
+	if (w == 0)
+		return 0;
+	v = in[k] >> s;
+	if (s + w > 64)
+		v |= in[k + lanes] << (64 - s);
+	return w == 64 ? v : v & (~uint64_t(0) >> (64 - w));
+}
+
+inline unsigned width(uint64_t v) {
+	unsigned w = 0;
+
+	while (v) {
+		v >>= 1;
+		w++;
+	}
+	return w;
+}
+}
+
+//ft::compressed_vector: an append-only vector of integers stored in blocks
+//of block_size. A block keeps its first value, then the deltas between
+//neighbours minus the block's smallest delta (frame of reference),
+//bit-packed at the width of the biggest one. Sorted ID lists end up at a
+//few bits per value.
+//Values are decoded a block at a time: iterating is sequential decoding,
+//operator[] decodes the block of its index, lower_bound() binary searches
+//the block heads first. The last, unfinished block is kept as it is.
+template<typename T>
+class compressed_vector {
+	struct block_info {
+		uint64_t first;
+		uint64_t min;
+		size_t offset;
+		unsigned width;
+	};
+
+public:
+	//Only integral types compress.
+	typedef typename enable_if<is_integral<T>::value, T>::type value_type;
+	typedef size_t size_type;
+
+	struct const_iterator;
+	typedef const_iterator iterator;
+
+	static const size_type block_size = packing::block;
+
+
+private:
+	vector<uint64_t> words;
+	vector<block_info> blocks;
+	value_type tail[block_size];
+	size_type tail_len;
+
+private:
+	//Utils:
+	//Packs tail into a new block.
+	void seal(void);
+
+	value_type head(size_type b) const {
+		if (b == blocks.size())
+			return tail[0];
+		return static_cast<value_type>(blocks[b].first);
+	}
+
+public:
+	compressed_vector(void): tail_len(0) {}
+
+	template<class InputIterator>
+	compressed_vector(InputIterator first,
+					  typename IsInputIter<InputIterator>::type last)
+			: tail_len(0) {
+		while (first != last)
+			push_back(*first++);
+	}
+
+	//Iterators:
+	const_iterator begin(void) const { return const_iterator(this, 0); }
+
+	const_iterator end(void) const { return const_iterator(this, size()); }
+
+	const_iterator cbegin(void) const { return begin(); }
+
+	const_iterator cend(void) const { return end(); }
+
+	//Element access:
+	//Values are not stored as such, so these return copies.
+	value_type operator[](const size_type i) const;
+
+	value_type at(const size_type n) const;
+
+	value_type front(void) const { return (*this)[0]; }
+
+	value_type back(void) const { return (*this)[size() - 1]; }
+
+	size_type block_count(void) const {
+		return blocks.size() + (tail_len != 0);
+	}
+
+	//Writes the values of block b to out, returns how many there were.
+	size_type decode(size_type b, value_type *out) const;
+
+	//Capacity:
+	size_type size(void) const { return blocks.size() * block_size + tail_len; }
+
+	bool empty(void) const { return size() == 0; }
+
+	//Bytes used for the values, including the block index.
+	size_type memory_usage(void) const {
+		return words.size() * sizeof(uint64_t)
+			   + blocks.size() * sizeof(block_info)
+			   + tail_len * sizeof(value_type);
+	}
+
+	//Modifiers:
+	void push_back(const value_type &val) {
+		tail[tail_len++] = val;
+		if (tail_len == block_size)
+			seal();
+	}
+
+	void clear(void) {
+		words.clear();
+		blocks.clear();
+		tail_len = 0;
+	}
+
+	void swap(compressed_vector &x);
+
+	//Lookup, for sorted contents only:
+	const_iterator lower_bound(const value_type &val) const;
+
+};
+
+//Compaire operators:
+template<typename T>
+bool operator==(const compressed_vector<T> &f, const compressed_vector<T> &s) {
+	return f.size() == s.size() && equal(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T>
+bool operator!=(const compressed_vector<T> &f, const compressed_vector<T> &s) {
+	return !(f == s);
+}
+
+//std::swap:
+template<typename T>
+void swap(compressed_vector<T> &f, compressed_vector<T> &s) { f.swap(s); }
+
+//Utils:
+template<typename T>
+void ft::compressed_vector<T>::seal(void) {
+	block_info info;
+	uint64_t deltas[block_size];
+	uint64_t max = 0;
+
+	info.first = static_cast<uint64_t>(tail[0]);
+	info.min = static_cast<uint64_t>(tail[1]) - info.first;
+	for (size_type i = 1; i < block_size; i++) {
+		deltas[i] = static_cast<uint64_t>(tail[i])
+					- static_cast<uint64_t>(tail[i - 1]);
+		if (static_cast<int64_t>(deltas[i]) < static_cast<int64_t>(info.min))
+			info.min = deltas[i];
+	}
+	deltas[0] = info.min;
+	for (size_type i = 0; i < block_size; i++) {
+		deltas[i] -= info.min;
+		if (deltas[i] > max)
+			max = deltas[i];
+	}
+	info.width = packing::width(max);
+	info.offset = words.size();
+	words.resize(words.size() + packing::words(info.width), 0);
+	packing::pack(deltas, words.data() + info.offset, info.width);
+	blocks.push_back(info);
+	tail_len = 0;
+}
+
+//Element acsses:
+template<typename T>
+typename ft::compressed_vector<T>::size_type
+ft::compressed_vector<T>::decode(size_type b, value_type *out) const {
+	uint64_t deltas[block_size];
+	uint64_t v;
+
+	if (b == blocks.size()) {
+		for (size_type i = 0; i < tail_len; i++)
+			out[i] = tail[i];
+		return tail_len;
+	}
+	const block_info &info = blocks[b];
+	packing::unpacker::get().table[info.width](
+			words.data() + info.offset, deltas);
+	v = info.first;
+	out[0] = static_cast<value_type>(v);
+	for (size_type i = 1; i < block_size; i++) {
+		v += deltas[i] + info.min;
+		out[i] = static_cast<value_type>(v);
+	}
+	return block_size;
+}
+
+template<typename T>
+typename ft::compressed_vector<T>::value_type
+ft::compressed_vector<T>::operator[](const size_type i) const {
+	size_type b = i / block_size;
+	size_type k = i % block_size;
+	uint64_t deltas[block_size];
+	uint64_t v;
+
+	if (b == blocks.size())
+		return tail[k];
+	const block_info &info = blocks[b];
+	packing::unpacker::get().table[info.width](
+			words.data() + info.offset, deltas);
+	v = info.first + k * info.min;
+	for (size_type j = 1; j <= k; j++)
+		v += deltas[j];
+	return static_cast<value_type>(v);
+}
+
+template<typename T>
+typename ft::compressed_vector<T>::value_type
+ft::compressed_vector<T>::at(const size_type n) const {
+	if (n < size())
+		return (*this)[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, size());
+	throw std::out_of_range(err);
+}
+
+//Modifiers:
+template<typename T>
+void ft::compressed_vector<T>::swap(compressed_vector &x) {
+	value_type tmp[block_size];
+	size_type tmp_len = x.tail_len;
+
+	if (this == &x)
+		return;
+	words.swap(x.words);
+	blocks.swap(x.blocks);
+	for (size_type i = 0; i < x.tail_len; i++)
+		tmp[i] = x.tail[i];
+	for (size_type i = 0; i < tail_len; i++)
+		x.tail[i] = tail[i];
+	x.tail_len = tail_len;
+	for (size_type i = 0; i < tmp_len; i++)
+		tail[i] = tmp[i];
+	tail_len = tmp_len;
+}
+
+//Lookup:
+template<typename T>
+typename ft::compressed_vector<T>::const_iterator
+ft::compressed_vector<T>::lower_bound(const value_type &val) const {
+	size_type lo = 0;
+	size_type hi = block_count();
+	size_type mid;
+	size_type n;
+	value_type buf[block_size];
+
+	//First block whose head is >= val, the answer is in the one before.
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (head(mid) < val)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == 0)
+		return begin();
+	n = decode(lo - 1, buf);
+	for (size_type i = 0; i < n; i++)
+		if (!(buf[i] < val))
+			return const_iterator(this, (lo - 1) * block_size + i);
+	return const_iterator(this, (lo - 1) * block_size + n);
+}
+
+//Values are not stored as such, so operator* returns a copy and the
+//iterator only claims to be an input iterator, although it has the random
+//access operations too. It keeps the value at its position: a step
+//forward inside a block unpacks one delta, any other move decodes the
+//value again.
+template<typename T>
+struct ft::compressed_vector<T>::const_iterator
+		: public iterator_base<std::input_iterator_tag, T, ptrdiff_t, void, T> {
+	typedef
+	typename const_iterator::iterator_base::difference_type diff_t;
+
+private:
+	const compressed_vector *vec;
+	size_type pos;
+	mutable size_type loaded;
+	mutable uint64_t val;
+	//The packed block of loaded, NULL in the unfinished one.
+	mutable const uint64_t *packed;
+	mutable uint64_t min;
+	mutable unsigned width;
+
+	value_type load(void) const {
+		size_type b = pos / block_size;
+
+		if (loaded == pos)
+			return static_cast<value_type>(val);
+		if (loaded + 1 == pos && pos % block_size && packed) {
+			val += min + packing::get(packed, pos % block_size, width);
+		} else {
+			val = static_cast<uint64_t>((*vec)[pos]);
+			packed = NULL;
+			if (b < vec->blocks.size()) {
+				packed = vec->words.data() + vec->blocks[b].offset;
+				min = vec->blocks[b].min;
+				width = vec->blocks[b].width;
+			}
+		}
+		loaded = pos;
+		return static_cast<value_type>(val);
+	}
+
+public:
+	const_iterator(void)
+			: vec(NULL), pos(0), loaded(-1), val(0), packed(NULL), min(0),
+			  width(0) {}
+
+	const_iterator(const compressed_vector *_vec, size_type _pos)
+			: vec(_vec), pos(_pos), loaded(-1), val(0), packed(NULL), min(0),
+			  width(0) {}
+
+	const_iterator operator+(diff_t n) const {
+		return const_iterator(vec, pos + n);
+	}
+
+	const_iterator operator-(diff_t n) const {
+		return const_iterator(vec, pos - n);
+	}
+
+	diff_t operator-(const const_iterator &rhs) const {
+		return static_cast<diff_t>(pos) - static_cast<diff_t>(rhs.base());
+	}
+
+	const_iterator &operator+=(diff_t n) {
+		pos += n;
+		return *this;
+	}
+
+	const_iterator &operator-=(diff_t n) {
+		pos -= n;
+		return *this;
+	}
+
+	const_iterator &operator++(void) {
+		++pos;
+		return *this;
+	}
+
+	const_iterator operator++(int) {
+		const_iterator tmp(*this);
+		++pos;
+		return tmp;
+	}
+
+	const_iterator &operator--(void) {
+		--pos;
+		return *this;
+	}
+
+	const_iterator operator--(int) {
+		const_iterator tmp(*this);
+		--pos;
+		return tmp;
+	}
+
+	value_type operator*(void) const { return load(); }
+
+	value_type operator[](diff_t n) const { return (*vec)[pos + n]; }
+
+	//Index in the vector, used by the common comparison operators.
+	size_type base(void) const { return pos; }
+};
+}
+
+#endif //FT_CONTAINERS_FINAL_COMPRESSED_VECTOR_HPP
@@ -0,0 +1,286 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_CONCURRENT_QUEUE_HPP
+#define FT_CONTAINERS_FINAL_CONCURRENT_QUEUE_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "utils.hpp"
+#include "atomic.hpp"
+
+namespace ft {
+//The ring size for a requested capacity: a power of two, at least 2.
+inline size_t ring_capacity(size_t n) {
+	size_t cap = 2;
+
+	while (cap < n)
+		cap <<= 1;
+	return cap;
+}
+
+//ft::spsc_queue: a bounded FIFO ring for exactly one producer thread and
+//one consumer thread. Every operation finishes in a bounded number of
+//steps (wait-free). Each side keeps a copy of the other side's index and
+//reads the shared one only when the copy says full or empty.
+//T has to be default constructible and assignable; popped values are
+//overwritten by T() unless T is trivially copyable.
+template<typename T>
+class spsc_queue {
+public:
+	typedef T value_type;
+	typedef size_t size_type;
+
+private:
+	T *buf;
+	size_type mask;
+	char pad0[cache_line];
+	//Producer side.
+	size_type head;
+	size_type tail_cache;
+	char pad1[cache_line - 2 * sizeof(size_type)];
+	//Consumer side.
+	size_type tail;
+	size_type head_cache;
+	char pad2[cache_line - 2 * sizeof(size_type)];
+
+	spsc_queue(const spsc_queue &);
+
+	spsc_queue &operator=(const spsc_queue &);
+
+public:
+	explicit spsc_queue(size_type _capacity)
+			: buf(new T[ring_capacity(_capacity)]),
+			  mask(ring_capacity(_capacity) - 1), head(0), tail_cache(0),
+			  tail(0), head_cache(0) {}
+
+	~spsc_queue(void) { delete[] buf; }
+
+	//Capacity:
+	size_type capacity(void) const { return mask + 1; }
+
+	//A snapshot, exact only when neither side is running. tail is read
+	//first: it never passes a head read after it, and head can only have
+	//moved on by what the consumer freed meanwhile, hence the clamp.
+	size_type size(void) const {
+		size_type first = __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+		size_type last = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+
+		return last - first > capacity() ? capacity() : last - first;
+	}
+
+	bool empty(void) const { return size() == 0; }
+
+	//Modifiers:
+	//Producer only. False when the queue is full.
+	bool try_push(const value_type &val) { return push_n(&val, 1) == 1; }
+
+	//Consumer only. False when the queue is empty.
+	bool try_pop(value_type &out) { return pop_n(&out, 1) == 1; }
+
+	//Producer only. Pushes up to n elements from first and publishes them
+	//at once, returns how many fitted.
+	template<typename InputIterator>
+	size_type push_n(InputIterator first, size_type n);
+
+	//Consumer only. Pops up to n elements to out, returns how many.
+	template<typename OutputIterator>
+	size_type pop_n(OutputIterator out, size_type n);
+};
+
+//ft::mpmc_queue: a bounded FIFO ring for any number of producers and
+//consumers (D. Vyukov's queue). Every cell has a sequence number that says
+//whose turn it is: seq == pos, free for the producer of position pos;
+//seq == pos + 1, full for its consumer. A thread claims a position with
+//one CAS on the shared index and then owns the cell until it bumps seq, so
+//the threads never wait on a lock, only a full or empty queue fails.
+//T has to be default constructible and assignable, as for spsc_queue.
+template<typename T>
+class mpmc_queue {
+public:
+	typedef T value_type;
+	typedef size_t size_type;
+
+private:
+	struct cell {
+		size_type seq;
+		T value;
+	};
+
+	cell *buf;
+	size_type mask;
+	char pad0[cache_line];
+	size_type enqueue_pos;
+	char pad1[cache_line - sizeof(size_type)];
+	size_type dequeue_pos;
+	char pad2[cache_line - sizeof(size_type)];
+
+	static intptr_t distance(size_type seq, size_type pos) {
+		return static_cast<intptr_t>(seq - pos);
+	}
+
+	mpmc_queue(const mpmc_queue &);
+
+	mpmc_queue &operator=(const mpmc_queue &);
+
+public:
+	explicit mpmc_queue(size_type _capacity);
+
+	~mpmc_queue(void) { delete[] buf; }
+
+	//Capacity:
+	size_type capacity(void) const { return mask + 1; }
+
+	//A snapshot: other threads may change it right after.
+	size_type size(void) const {
+		size_type tail = __atomic_load_n(&dequeue_pos, __ATOMIC_ACQUIRE);
+		size_type head = __atomic_load_n(&enqueue_pos, __ATOMIC_ACQUIRE);
+
+		return distance(head, tail) > 0 ? head - tail : 0;
+	}
+
+	bool empty(void) const { return size() == 0; }
+
+	//Modifiers:
+	//False when the queue is full.
+	bool try_push(const value_type &val) { return push_n(&val, 1) == 1; }
+
+	//False when the queue is empty.
+	bool try_pop(value_type &out) { return pop_n(&out, 1) == 1; }
+
+	//Claims up to n consecutive free cells with a single CAS and fills
+	//them from first. Returns how many, 0 when the queue is full.
+	template<typename InputIterator>
+	size_type push_n(InputIterator first, size_type n);
+
+	//Claims up to n consecutive full cells with a single CAS and pops
+	//them to out. Returns how many, 0 when the queue is empty.
+	template<typename OutputIterator>
+	size_type pop_n(OutputIterator out, size_type n);
+};
+
+//Modifiers:
+template<typename T>
+template<typename InputIterator>
+typename ft::spsc_queue<T>::size_type
+ft::spsc_queue<T>::push_n(InputIterator first, size_type n) {
+	size_type cap = mask + 1;
+	size_type pos = head;
+
+	if (cap - (pos - tail_cache) < n)
+		tail_cache = __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+	if (n > cap - (pos - tail_cache))
+		n = cap - (pos - tail_cache);
+	for (size_type i = 0; i < n; i++, ++first)
+		buf[(pos + i) & mask] = *first;
+	__atomic_store_n(&head, pos + n, __ATOMIC_RELEASE);
+	return n;
+}
+
+template<typename T>
+template<typename OutputIterator>
+typename ft::spsc_queue<T>::size_type
+ft::spsc_queue<T>::pop_n(OutputIterator out, size_type n) {
+	size_type pos = tail;
+
+	if (head_cache - pos < n)
+		head_cache = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+	if (n > head_cache - pos)
+		n = head_cache - pos;
+	for (size_type i = 0; i < n; i++, ++out) {
+		T &val = buf[(pos + i) & mask];
+		*out = val;
+		if (!is_trivially_copyable<T>::value)
+			val = T();
+	}
+	__atomic_store_n(&tail, pos + n, __ATOMIC_RELEASE);
+	return n;
+}
+
+template<typename T>
+ft::mpmc_queue<T>::mpmc_queue(size_type _capacity)
+		: buf(new cell[ring_capacity(_capacity)]),
+		  mask(ring_capacity(_capacity) - 1), enqueue_pos(0), dequeue_pos(0) {
+	for (size_type i = 0; i <= mask; i++)
+		buf[i].seq = i;
+}
+
+template<typename T>
+template<typename InputIterator>
+typename ft::mpmc_queue<T>::size_type
+ft::mpmc_queue<T>::push_n(InputIterator first, size_type n) {
+	size_type pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+	size_type k;
+
+	for (;;) {
+		//Cells pos .. pos + k - 1 are free in this round. Only the
+		//producer that claims them can change that, so they stay free if
+		//the CAS succeeds.
+		for (k = 0; k < n && k <= mask; k++) {
+			size_type seq = __atomic_load_n(&buf[(pos + k) & mask].seq,
+											__ATOMIC_ACQUIRE);
+			if (distance(seq, pos + k) != 0)
+				break;
+		}
+		if (k == 0) {
+			size_type seq = __atomic_load_n(&buf[pos & mask].seq,
+											__ATOMIC_ACQUIRE);
+			//Full: the cell still holds the value of the last round.
+			if (distance(seq, pos) < 0)
+				return 0;
+			pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+			continue;
+		}
+		if (__atomic_compare_exchange_n(&enqueue_pos, &pos, pos + k, true,
+										__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			break;
+	}
+	for (size_type i = 0; i < k; i++, ++first) {
+		cell &c = buf[(pos + i) & mask];
+		c.value = *first;
+		__atomic_store_n(&c.seq, pos + i + 1, __ATOMIC_RELEASE);
+	}
+	return k;
+}
+
+template<typename T>
+template<typename OutputIterator>
+typename ft::mpmc_queue<T>::size_type
+ft::mpmc_queue<T>::pop_n(OutputIterator out, size_type n) {
+	size_type pos = __atomic_load_n(&dequeue_pos, __ATOMIC_RELAXED);
+	size_type k;
+
+	for (;;) {
+		for (k = 0; k < n && k <= mask; k++) {
+			size_type seq = __atomic_load_n(&buf[(pos + k) & mask].seq,
+											__ATOMIC_ACQUIRE);
+			if (distance(seq, pos + k + 1) != 0)
+				break;
+		}
+		if (k == 0) {
+			size_type seq = __atomic_load_n(&buf[pos & mask].seq,
+											__ATOMIC_ACQUIRE);
+			//Empty: the producer of pos has not published it yet.
+			if (distance(seq, pos + 1) < 0)
+				return 0;
+			pos = __atomic_load_n(&dequeue_pos, __ATOMIC_RELAXED);
+			continue;
+		}
+		if (__atomic_compare_exchange_n(&dequeue_pos, &pos, pos + k, true,
+										__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			break;
+	}
+	for (size_type i = 0; i < k; i++, ++out) {
+		cell &c = buf[(pos + i) & mask];
+		*out = c.value;
+		if (!is_trivially_copyable<T>::value)
+			c.value = T();
+		__atomic_store_n(&c.seq, pos + i + mask + 1, __ATOMIC_RELEASE);
+	}
+	return k;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_CONCURRENT_QUEUE_HPP
@@ -0,0 +1,424 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_CONCURRENT_SKIPLIST_MAP_HPP
+#define FT_CONTAINERS_FINAL_CONCURRENT_SKIPLIST_MAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdint.h>
+
+#include "pair.hpp"
+#include "atomic.hpp"
+#include "epoch.hpp"
+
+namespace ft {
+//ft::concurrent_skiplist_map: an ordered map for many threads, a
+//lock-free skip list (Fraser, Herlihy & Shavit).
+//A node is erased by setting the low bit of its next pointers, top level
+//first. Level 0 decides: the thread that marks it erased the key. Marked
+//nodes are unlinked by whoever passes them in a search, and retired to
+//ft::epoch_domain by the eraser once no level links them any more.
+//insert() may still be linking the upper levels of a node that gets
+//erased. The state of the node then hands the retire over to it.
+//Iterators hold an epoch_guard, so the node they point to stays valid
+//even if it is erased meanwhile; ++ then goes on from where it was.
+//Iteration is weakly consistent: it sees every key present for its whole
+//duration and any number of the ones changed meanwhile. An iterator must
+//not be passed to another thread.
+template<typename Key, typename T, typename Compare = std::less<Key> >
+class concurrent_skiplist_map {
+public:
+	typedef Key							key_type;
+	typedef T							mapped_type;
+	typedef pair<const Key, T>			value_type;
+	typedef Compare						key_compare;
+	typedef size_t						size_type;
+	typedef value_type					&reference;
+	typedef value_type					*pointer;
+
+private:
+	static const int max_level = 24;
+	enum { linking = 0, linked = 1, erased_while_linking = 2 };
+
+	struct node {
+		value_type value;
+		int height;
+		int state;
+		//height of them, the low bit marks the node erased at that level.
+		uintptr_t next[1];
+
+		node(const value_type &_value, int _height)
+				: value(_value), height(_height), state(linking) {}
+	};
+
+	node *head;
+	size_type elements;
+	Compare comp;
+
+	//Utils:
+	static node *ptr(uintptr_t link) {
+		return reinterpret_cast<node *>(link & ~static_cast<uintptr_t>(1));
+	}
+
+	static uintptr_t word(node *n) { return reinterpret_cast<uintptr_t>(n); }
+
+	static bool marked(uintptr_t link) { return link & 1; }
+
+	static uintptr_t load(node *n, int level) {
+		return __atomic_load_n(&n->next[level], __ATOMIC_ACQUIRE);
+	}
+
+	static bool cas(node *n, int level, uintptr_t &expected, uintptr_t val) {
+		return __atomic_compare_exchange_n(&n->next[level], &expected, val,
+										   false, __ATOMIC_ACQ_REL,
+										   __ATOMIC_ACQUIRE);
+	}
+
+	static int random_height(void) {
+		unsigned int r = thread_random();
+		int h = 1;
+
+		while ((r & 1) && h < max_level) {
+			h++;
+			r >>= 1;
+		}
+		return h;
+	}
+
+	static node *create(const value_type &val, int height);
+
+	static void destroy(void *n) {
+		static_cast<node *>(n)->~node();
+		::operator delete(n);
+	}
+
+	static node *next_live(node *n);
+
+	bool search(const key_type &key, node **preds, node **succs);
+
+	node *lower_node(const key_type &key) const;
+
+	void retire(node *n);
+
+	concurrent_skiplist_map(const concurrent_skiplist_map &);
+
+	concurrent_skiplist_map &operator=(const concurrent_skiplist_map &);
+
+public:
+	class iterator {
+		node *n;
+		epoch_guard guard;
+
+	public:
+		typedef std::forward_iterator_tag	iterator_category;
+		typedef pair<const Key, T>			value_type;
+		typedef ptrdiff_t					difference_type;
+		typedef value_type					*pointer;
+		typedef value_type					&reference;
+
+		iterator(void): n(NULL) {}
+
+		explicit iterator(node *_n): n(_n) {}
+
+		reference operator*(void) const { return n->value; }
+
+		pointer operator->(void) const { return &n->value; }
+
+		iterator &operator++(void) {
+			n = next_live(n);
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator tmp(*this);
+			n = next_live(n);
+			return tmp;
+		}
+
+		bool operator==(const iterator &x) const { return n == x.n; }
+
+		bool operator!=(const iterator &x) const { return n != x.n; }
+	};
+
+	typedef iterator const_iterator;
+
+	explicit concurrent_skiplist_map(const Compare &_comp = Compare());
+
+	~concurrent_skiplist_map(void);
+
+	iterator begin(void) const {
+		epoch_guard guard;
+
+		return iterator(next_live(head));
+	}
+
+	iterator end(void) const { return iterator(); }
+
+	//Capacity:
+	//Snapshots: other threads may change them right after.
+	size_type size(void) const {
+		return __atomic_load_n(&elements, __ATOMIC_RELAXED);
+	}
+
+	bool empty(void) const { return begin() == end(); }
+
+	//Element acsses:
+	iterator find(const key_type &key) const;
+
+	size_type count(const key_type &key) const { return find(key) != end(); }
+
+	iterator lower_bound(const key_type &key) const {
+		epoch_guard guard;
+
+		return iterator(lower_node(key));
+	}
+
+	iterator upper_bound(const key_type &key) const;
+
+	key_compare key_comp(void) const { return comp; }
+
+	//Modifiers:
+	//Does nothing when key is there, as ft::map.
+	pair<iterator, bool> insert(const value_type &val);
+
+	size_type erase(const key_type &key);
+
+	//Erases what it finds, keys inserted meanwhile may stay.
+	void clear(void);
+};
+
+template<typename Key, typename T, typename Compare>
+ft::concurrent_skiplist_map<Key, T, Compare>::concurrent_skiplist_map(
+		const Compare &_comp): elements(0), comp(_comp) {
+	//A node without a value: the list starts after it at every level.
+	head = static_cast<node *>(::operator new(
+			sizeof(node) + (max_level - 1) * sizeof(uintptr_t)));
+	head->height = max_level;
+	head->state = linked;
+	for (int l = 0; l < max_level; l++)
+		head->next[l] = 0;
+}
+
+//No other thread may use the map any more, retired nodes are already out.
+template<typename Key, typename T, typename Compare>
+ft::concurrent_skiplist_map<Key, T, Compare>::~concurrent_skiplist_map(void) {
+	node *n = ptr(head->next[0]);
+
+	while (n) {
+		node *next = ptr(n->next[0]);
+		destroy(n);
+		n = next;
+	}
+	::operator delete(head);
+}
+
+//Utils:
+template<typename Key, typename T, typename Compare>
+typename ft::concurrent_skiplist_map<Key, T, Compare>::node *
+ft::concurrent_skiplist_map<Key, T, Compare>::create(const value_type &val,
+													 int height) {
+	void *raw = ::operator new(sizeof(node)
+							   + (height - 1) * sizeof(uintptr_t));
+
+	try {
+		return new(raw) node(val, height);
+	} catch (...) {
+		::operator delete(raw);
+		throw;
+	}
+}
+
+//The first node after n not erased at level 0, NULL at the end.
+template<typename Key, typename T, typename Compare>
+typename ft::concurrent_skiplist_map<Key, T, Compare>::node *
+ft::concurrent_skiplist_map<Key, T, Compare>::next_live(node *n) {
+	node *curr = ptr(load(n, 0));
+
+	while (curr && marked(load(curr, 0)))
+		curr = ptr(load(curr, 0));
+	return curr;
+}
+
+//Fills preds and succs with the nodes around key at every level and
+//unlinks the marked nodes on the way. True when succs[0] holds key.
+template<typename Key, typename T, typename Compare>
+bool ft::concurrent_skiplist_map<Key, T, Compare>::search(
+		const key_type &key, node **preds, node **succs) {
+retry:
+	node *pred = head;
+	for (int l = max_level - 1; l >= 0; l--) {
+		node *curr = ptr(load(pred, l));
+		while (curr) {
+			uintptr_t succ = load(curr, l);
+			while (marked(succ)) {
+				uintptr_t expected = word(curr);
+				//Fails if pred got marked or linked something else.
+				if (!cas(pred, l, expected, word(ptr(succ))))
+					goto retry;
+				curr = ptr(succ);
+				if (!curr)
+					break;
+				succ = load(curr, l);
+			}
+			if (!curr || !comp(curr->value.first, key))
+				break;
+			pred = curr;
+			curr = ptr(succ);
+		}
+		preds[l] = pred;
+		succs[l] = curr;
+	}
+	return succs[0] && !comp(key, succs[0]->value.first);
+}
+
+//The first node not erased whose key is not less than key. Read only:
+//marked nodes are stepped over, not unlinked.
+template<typename Key, typename T, typename Compare>
+typename ft::concurrent_skiplist_map<Key, T, Compare>::node *
+ft::concurrent_skiplist_map<Key, T, Compare>::lower_node(
+		const key_type &key) const {
+	node *pred = head;
+	node *curr = NULL;
+
+	for (int l = max_level - 1; l >= 0; l--) {
+		curr = ptr(load(pred, l));
+		while (curr) {
+			uintptr_t succ = load(curr, l);
+			if (!marked(succ) && !comp(curr->value.first, key))
+				break;
+			if (!marked(succ))
+				pred = curr;
+			curr = ptr(succ);
+		}
+	}
+	return curr;
+}
+
+//Unlinks n from every level, then retires it.
+template<typename Key, typename T, typename Compare>
+void ft::concurrent_skiplist_map<Key, T, Compare>::retire(node *n) {
+	node *preds[max_level];
+	node *succs[max_level];
+
+	search(n->value.first, preds, succs);
+	epoch_domain::instance().retire(n, destroy);
+}
+
+//Element acsses:
+template<typename Key, typename T, typename Compare>
+typename ft::concurrent_skiplist_map<Key, T, Compare>::iterator
+ft::concurrent_skiplist_map<Key, T, Compare>::find(const key_type &key) const {
+	epoch_guard guard;
+	node *n = lower_node(key);
+
+	if (n && !comp(key, n->value.first))
+		return iterator(n);
+	return iterator();
+}
+
+template<typename Key, typename T, typename Compare>
+typename ft::concurrent_skiplist_map<Key, T, Compare>::iterator
+ft::concurrent_skiplist_map<Key, T, Compare>::upper_bound(
+		const key_type &key) const {
+	epoch_guard guard;
+	node *n = lower_node(key);
+
+	if (n && !comp(key, n->value.first))
+		n = next_live(n);
+	return iterator(n);
+}
+
+//Modifiers:
+template<typename Key, typename T, typename Compare>
+ft::pair<typename ft::concurrent_skiplist_map<Key, T, Compare>::iterator, bool>
+ft::concurrent_skiplist_map<Key, T, Compare>::insert(const value_type &val) {
+	epoch_guard guard;
+	node *preds[max_level];
+	node *succs[max_level];
+	int height = random_height();
+	node *n = NULL;
+	int state = linking;
+
+	for (;;) {
+		if (search(val.first, preds, succs)) {
+			if (n)
+				destroy(n);
+			return ft::make_pair(iterator(succs[0]), false);
+		}
+		if (!n)
+			n = create(val, height);
+		for (int l = 0; l < height; l++)
+			__atomic_store_n(&n->next[l], word(succs[l]), __ATOMIC_RELAXED);
+		uintptr_t expected = word(succs[0]);
+		//Linked at level 0: the key is in the map from here on.
+		if (cas(preds[0], 0, expected, word(n)))
+			break;
+	}
+	__atomic_add_fetch(&elements, 1, __ATOMIC_RELAXED);
+	for (int l = 1; l < height; l++) {
+		for (;;) {
+			uintptr_t next = load(n, l);
+			//Marked: an erase started, stop building.
+			if (marked(next) || (ptr(next) != succs[l]
+								 && !cas(n, l, next, word(succs[l]))))
+				goto done;
+			uintptr_t expected = word(succs[l]);
+			if (cas(preds[l], l, expected, word(n)))
+				break;
+			if (!search(val.first, preds, succs) || succs[0] != n)
+				goto done;
+		}
+	}
+done:
+	if (!__atomic_compare_exchange_n(&n->state, &state, linked, false,
+									 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		retire(n);
+	return ft::make_pair(iterator(n), true);
+}
+
+template<typename Key, typename T, typename Compare>
+typename ft::concurrent_skiplist_map<Key, T, Compare>::size_type
+ft::concurrent_skiplist_map<Key, T, Compare>::erase(const key_type &key) {
+	epoch_guard guard;
+	node *preds[max_level];
+	node *succs[max_level];
+	node *n;
+	uintptr_t next;
+	int state = linking;
+
+	if (!search(key, preds, succs))
+		return 0;
+	n = succs[0];
+	for (int l = n->height - 1; l > 0; l--) {
+		next = load(n, l);
+		while (!marked(next) && !cas(n, l, next, next | 1))
+			;
+	}
+	next = load(n, 0);
+	for (;;) {
+		if (marked(next))
+			return 0;
+		if (cas(n, 0, next, next | 1))
+			break;
+	}
+	__atomic_sub_fetch(&elements, 1, __ATOMIC_RELAXED);
+	//insert() is still building the tower of n, it retires n itself.
+	if (!__atomic_compare_exchange_n(&n->state, &state, erased_while_linking,
+									 false, __ATOMIC_ACQ_REL,
+									 __ATOMIC_ACQUIRE))
+		retire(n);
+	return 1;
+}
+
+template<typename Key, typename T, typename Compare>
+void ft::concurrent_skiplist_map<Key, T, Compare>::clear(void) {
+	for (iterator it = begin(); it != end(); ++it)
+		erase(it->first);
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_CONCURRENT_SKIPLIST_MAP_HPP
@@ -0,0 +1,297 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_CONCURRENT_STACK_HPP
+#define FT_CONTAINERS_FINAL_CONCURRENT_STACK_HPP
+
+#include <cstddef>
+#include <new>
+#include <stdint.h>
+
+#include "utils.hpp"
+#include "atomic.hpp"
+
+namespace ft {
+enum concurrent_stack_mode {
+	stack_plain = 0,
+	//Pushes and pops that lose a CAS on the top meet in a small array and
+	//hand the element over without touching the top again.
+	stack_elimination = 1
+};
+
+//ft::concurrent_stack: a lock-free (Treiber) stack for many producers and
+//consumers.
+//Nodes come from a pool owned by the stack and are never given back to
+//the allocator before the stack dies, so a node read by a losing thread
+//is still memory of the stack. A node is named by a 32-bit index, and the
+//top is the index plus a 32-bit tag that every successful CAS increments:
+//a top that was popped and pushed back in between does not compare equal
+//(no ABA), with a plain 64-bit CAS.
+//The free nodes are a second such stack. T has to be default
+//constructible and assignable; popped values are overwritten by T() unless
+//T is trivially copyable.
+template<typename T>
+class concurrent_stack {
+public:
+	typedef T value_type;
+	typedef size_t size_type;
+
+private:
+	struct node {
+		T value;
+		uint32_t next;
+
+		node(void): value(), next(0) {}
+	};
+
+	static const uint32_t null_index = 0xFFFFFFFFu;
+	//Chunk k holds first_chunk << k nodes, the 26 of them 2^32 - 64.
+	static const uint32_t first_chunk = 64;
+	static const size_t max_chunks = 26;
+	static const size_t slot_count = 16;
+	static const unsigned int slot_spins = 128;
+
+	//On their own cache lines: every operation CASes one of them.
+	uint64_t head;
+	char pad1[64 - sizeof(uint64_t)];
+	uint64_t free_head;
+	char pad2[64 - sizeof(uint64_t)];
+	uint32_t allocated;
+	uint32_t ticket;
+	concurrent_stack_mode mode;
+	node *chunks[max_chunks];
+	//Elimination: 0 or the tag << 32 | index of a node being pushed.
+	uint64_t slots[slot_count];
+
+	//Utils:
+	static uint64_t pack(uint32_t index, uint32_t tag) {
+		return static_cast<uint64_t>(tag) << 32 | index;
+	}
+
+	static uint32_t index_of(uint64_t word) {
+		return static_cast<uint32_t>(word);
+	}
+
+	static uint32_t tag_of(uint64_t word) {
+		return static_cast<uint32_t>(word >> 32);
+	}
+
+	static size_t chunk_of(uint32_t i) {
+		return 31 - __builtin_clz(i / first_chunk + 1);
+	}
+
+	node &at(uint32_t i) const {
+		size_t k = chunk_of(i);
+
+		return __atomic_load_n(&chunks[k], __ATOMIC_ACQUIRE)
+				[i - first_chunk * ((1u << k) - 1)];
+	}
+
+	bool try_push(uint64_t *top, uint32_t i);
+
+	void push_node(uint64_t *top, uint32_t i);
+
+	uint32_t pop_node(uint64_t *top);
+
+	uint32_t alloc_node(void);
+
+	bool give(uint32_t i);
+
+	uint32_t take(void);
+
+	uint32_t take_value(uint32_t i, value_type &out);
+
+	concurrent_stack(const concurrent_stack &);
+
+	concurrent_stack &operator=(const concurrent_stack &);
+
+public:
+	explicit concurrent_stack(concurrent_stack_mode _mode = stack_plain);
+
+	~concurrent_stack(void);
+
+	//A snapshot: other threads may change it right after.
+	bool empty(void) const {
+		return index_of(__atomic_load_n(&head, __ATOMIC_ACQUIRE)) == null_index;
+	}
+
+	concurrent_stack_mode get_mode(void) const { return mode; }
+
+	//Modifiers:
+	void push(const value_type &val);
+
+	//Pops the top into out, false when the stack was empty.
+	bool try_pop(value_type &out);
+};
+
+template<typename T>
+ft::concurrent_stack<T>::concurrent_stack(concurrent_stack_mode _mode)
+		: head(pack(null_index, 0)), free_head(pack(null_index, 0)),
+		  allocated(0), ticket(0), mode(_mode) {
+	for (size_t k = 0; k < max_chunks; k++)
+		chunks[k] = NULL;
+	for (size_t s = 0; s < slot_count; s++)
+		slots[s] = 0;
+}
+
+template<typename T>
+ft::concurrent_stack<T>::~concurrent_stack(void) {
+	for (size_t k = 0; k < max_chunks; k++)
+		delete[] chunks[k];
+}
+
+//Utils:
+template<typename T>
+bool ft::concurrent_stack<T>::try_push(uint64_t *top, uint32_t i) {
+	uint64_t old = __atomic_load_n(top, __ATOMIC_ACQUIRE);
+
+	__atomic_store_n(&at(i).next, index_of(old), __ATOMIC_RELAXED);
+	return __atomic_compare_exchange_n(top, &old, pack(i, tag_of(old) + 1),
+									   false, __ATOMIC_RELEASE,
+									   __ATOMIC_RELAXED);
+}
+
+template<typename T>
+void ft::concurrent_stack<T>::push_node(uint64_t *top, uint32_t i) {
+	backoff wait;
+
+	while (!try_push(top, i))
+		wait();
+}
+
+template<typename T>
+uint32_t ft::concurrent_stack<T>::pop_node(uint64_t *top) {
+	uint64_t old = __atomic_load_n(top, __ATOMIC_ACQUIRE);
+	backoff wait;
+
+	for (;;) {
+		uint32_t i = index_of(old);
+		if (i == null_index)
+			return null_index;
+		//i may be popped and reused meanwhile, next is then stale and the
+		//tag makes the CAS fail.
+		uint32_t next = __atomic_load_n(&at(i).next, __ATOMIC_RELAXED);
+		if (__atomic_compare_exchange_n(top, &old, pack(next, tag_of(old) + 1),
+										false, __ATOMIC_ACQ_REL,
+										__ATOMIC_ACQUIRE))
+			return i;
+		wait();
+		old = __atomic_load_n(top, __ATOMIC_ACQUIRE);
+	}
+}
+
+template<typename T>
+uint32_t ft::concurrent_stack<T>::alloc_node(void) {
+	uint32_t i = pop_node(&free_head);
+	size_t k;
+
+	if (i != null_index)
+		return i;
+	i = __atomic_fetch_add(&allocated, 1, __ATOMIC_RELAXED);
+	if (i >= first_chunk * ((1u << (max_chunks - 1)) * 2 - 1))
+		throw std::bad_alloc();
+	k = chunk_of(i);
+	if (__atomic_load_n(&chunks[k], __ATOMIC_ACQUIRE) == NULL) {
+		node *chunk = new node[static_cast<size_t>(first_chunk) << k];
+		node *expected = NULL;
+		if (!__atomic_compare_exchange_n(&chunks[k], &expected, chunk, false,
+										 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			delete[] chunk;
+	}
+	return i;
+}
+
+//Offers node i in a random slot for a while. True when a pop took it.
+template<typename T>
+bool ft::concurrent_stack<T>::give(uint32_t i) {
+	uint64_t *slot = &slots[thread_random() % slot_count];
+	uint32_t tag = __atomic_add_fetch(&ticket, 1, __ATOMIC_RELAXED);
+	uint64_t expected = 0;
+	uint64_t offer;
+
+	if (tag == 0)
+		tag = __atomic_add_fetch(&ticket, 1, __ATOMIC_RELAXED);
+	offer = pack(i, tag);
+	if (!__atomic_compare_exchange_n(slot, &expected, offer, false,
+									 __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+		return false;
+	for (unsigned int s = 0; s < slot_spins; s++) {
+		if (__atomic_load_n(slot, __ATOMIC_ACQUIRE) != offer)
+			return true;
+		cpu_relax();
+	}
+	expected = offer;
+	return !__atomic_compare_exchange_n(slot, &expected, 0, false,
+										__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+//Takes the node offered in a random slot, null_index when there is none.
+template<typename T>
+uint32_t ft::concurrent_stack<T>::take(void) {
+	uint64_t *slot = &slots[thread_random() % slot_count];
+	uint64_t offer = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+
+	if (offer == 0 || !__atomic_compare_exchange_n(slot, &offer, 0, false,
+												   __ATOMIC_ACQ_REL,
+												   __ATOMIC_RELAXED))
+		return null_index;
+	return index_of(offer);
+}
+
+template<typename T>
+uint32_t ft::concurrent_stack<T>::take_value(uint32_t i, value_type &out) {
+	node &n = at(i);
+
+	out = n.value;
+	if (!is_trivially_copyable<T>::value)
+		n.value = T();
+	push_node(&free_head, i);
+	return i;
+}
+
+//Modifiers:
+template<typename T>
+void ft::concurrent_stack<T>::push(const value_type &val) {
+	uint32_t i = alloc_node();
+
+	at(i).value = val;
+	if (mode == stack_plain) {
+		push_node(&head, i);
+		return;
+	}
+	while (!try_push(&head, i))
+		if (give(i))
+			return;
+}
+
+template<typename T>
+bool ft::concurrent_stack<T>::try_pop(value_type &out) {
+	uint32_t i;
+
+	if (mode == stack_plain) {
+		i = pop_node(&head);
+		if (i == null_index)
+			return false;
+		take_value(i, out);
+		return true;
+	}
+	for (;;) {
+		uint64_t old = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+		i = index_of(old);
+		if (i == null_index)
+			return false;
+		uint32_t next = __atomic_load_n(&at(i).next, __ATOMIC_RELAXED);
+		if (__atomic_compare_exchange_n(&head, &old, pack(next, tag_of(old) + 1),
+										false, __ATOMIC_ACQ_REL,
+										__ATOMIC_ACQUIRE))
+			break;
+		if ((i = take()) != null_index)
+			break;
+	}
+	take_value(i, out);
+	return true;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_CONCURRENT_STACK_HPP
@@ -0,0 +1,274 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_CONCURRENT_VECTOR_HPP
+#define FT_CONTAINERS_FINAL_CONCURRENT_VECTOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+
+#include "utils.hpp"
+#include "vector.hpp"
+#include "iterators.hpp"
+#include "atomic.hpp"
+
+namespace ft {
+//ft::concurrent_vector: an append-only vector for many threads.
+//Elements live in segments of first_segment, 2 * first_segment,
+//4 * first_segment ... elements that are never moved or freed before the
+//vector dies, so a reference to an element stays valid while other
+//threads append.
+//An append claims its indices with one fetch_add, allocates the segments
+//it needs if nobody did (a CAS from NULL), constructs the elements and
+//marks them ready. size() is the length of the ready prefix: [0, size())
+//can be read from any thread while appends go on.
+//T's copy constructor must not throw: a slot left unconstructed stops
+//size() before it for good.
+template<typename T>
+class concurrent_vector {
+public:
+	typedef T			value_type;
+	typedef size_t		size_type;
+	typedef T			&reference;
+	typedef const T		&const_reference;
+
+	static const size_type first_segment = 16;
+
+private:
+	static const size_type max_segments = sizeof(size_type) * 8 - 4;
+
+	//A segment is its elements followed by one ready flag per element.
+	char *segments[max_segments];
+	size_type claimed;
+	char pad[cache_line - sizeof(size_type)];
+	mutable size_type published;
+
+	//Utils:
+	static size_type segment_of(size_type i) {
+		return sizeof(unsigned long) * 8 - 1
+				- __builtin_clzl(i / first_segment + 1);
+	}
+
+	static size_type segment_start(size_type k) {
+		return first_segment * ((static_cast<size_type>(1) << k) - 1);
+	}
+
+	static size_type segment_size(size_type k) { return first_segment << k; }
+
+	char *segment(size_type k) const {
+		return __atomic_load_n(&segments[k], __ATOMIC_ACQUIRE);
+	}
+
+	T *slot(char *seg, size_type k, size_type i) const {
+		return reinterpret_cast<T *>(seg) + (i - segment_start(k));
+	}
+
+	char *ready_flag(char *seg, size_type k, size_type i) const {
+		return seg + segment_size(k) * sizeof(T) + (i - segment_start(k));
+	}
+
+	char *need_segment(size_type k);
+
+	size_type claim(size_type n);
+
+	void construct(size_type i, const T &val) {
+		size_type k = segment_of(i);
+		char *seg = need_segment(k);
+
+		new(slot(seg, k, i)) T(val);
+		__atomic_store_n(ready_flag(seg, k, i), 1, __ATOMIC_RELEASE);
+	}
+
+	concurrent_vector(const concurrent_vector &);
+
+	concurrent_vector &operator=(const concurrent_vector &);
+
+public:
+	concurrent_vector(void);
+
+	~concurrent_vector(void);
+
+	//Capacity:
+	//The ready prefix. Grows while other threads append.
+	size_type size(void) const;
+
+	bool empty(void) const { return size() == 0; }
+
+	//Element acsses:
+	//i has to be below a size() seen before.
+	reference operator[](size_type i) {
+		size_type k = segment_of(i);
+
+		return *slot(segment(k), k, i);
+	}
+
+	const_reference operator[](size_type i) const {
+		size_type k = segment_of(i);
+
+		return *slot(segment(k), k, i);
+	}
+
+	reference at(size_type i);
+
+	const_reference at(size_type i) const;
+
+	//Modifiers:
+	//Returns the index of the new element.
+	size_type push_back(const value_type &val) {
+		size_type i = claim(1);
+
+		construct(i, val);
+		return i;
+	}
+
+	//Appends n copies of val at consecutive indices, returns the first.
+	size_type grow_by(size_type n, const value_type &val = value_type());
+
+	//Appends [first, last) at consecutive indices, returns the first.
+	template<typename ForwardIterator>
+	size_type grow_by(ForwardIterator first,
+					  typename IsInputIter<ForwardIterator>::type last);
+
+	//A contiguous copy of the ready prefix.
+	vector<T> compact(void) const;
+};
+
+template<typename T>
+const typename concurrent_vector<T>::size_type concurrent_vector<T>::first_segment;
+
+template<typename T>
+ft::concurrent_vector<T>::concurrent_vector(void): claimed(0), published(0) {
+	for (size_type k = 0; k < max_segments; k++)
+		segments[k] = NULL;
+}
+
+//No other thread may use the vector any more.
+template<typename T>
+ft::concurrent_vector<T>::~concurrent_vector(void) {
+	size_type n = claimed;
+
+	for (size_type k = 0; k < max_segments; k++) {
+		if (!segments[k])
+			continue;
+		for (size_type i = segment_start(k);
+			 i < segment_start(k + 1) && i < n; i++)
+			if (*ready_flag(segments[k], k, i))
+				slot(segments[k], k, i)->~T();
+		::operator delete(segments[k]);
+	}
+}
+
+//Utils:
+template<typename T>
+char *ft::concurrent_vector<T>::need_segment(size_type k) {
+	char *seg = segment(k);
+	char *expected = NULL;
+
+	if (seg)
+		return seg;
+	seg = static_cast<char *>(::operator new(segment_size(k) * (sizeof(T) + 1)));
+	for (size_type i = 0; i < segment_size(k); i++)
+		seg[segment_size(k) * sizeof(T) + i] = 0;
+	if (__atomic_compare_exchange_n(&segments[k], &expected, seg, false,
+									__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		return seg;
+	::operator delete(seg);
+	return expected;
+}
+
+template<typename T>
+typename ft::concurrent_vector<T>::size_type
+ft::concurrent_vector<T>::claim(size_type n) {
+	size_type i = __atomic_fetch_add(&claimed, n, __ATOMIC_RELAXED);
+
+	if (n > segment_start(max_segments) - i)
+		throw std::length_error("ft::concurrent_vector: too many elements");
+	return i;
+}
+
+//Capacity:
+template<typename T>
+typename ft::concurrent_vector<T>::size_type
+ft::concurrent_vector<T>::size(void) const {
+	size_type start = __atomic_load_n(&published, __ATOMIC_ACQUIRE);
+	size_type end = __atomic_load_n(&claimed, __ATOMIC_ACQUIRE);
+	size_type p = start;
+
+	while (p < end) {
+		size_type k = segment_of(p);
+		char *seg = segment(k);
+		if (!seg || !__atomic_load_n(ready_flag(seg, k, p), __ATOMIC_ACQUIRE))
+			break;
+		p++;
+	}
+	//Moves the shared mark up so that the next call starts from there.
+	while (start < p && !__atomic_compare_exchange_n(&published, &start, p,
+													 true, __ATOMIC_RELEASE,
+													 __ATOMIC_ACQUIRE))
+		;
+	return p;
+}
+
+//Element acsses:
+template<typename T>
+typename ft::concurrent_vector<T>::reference
+ft::concurrent_vector<T>::at(size_type i) {
+	if (i >= size())
+		throw std::out_of_range("ft::concurrent_vector: index out of range");
+	return (*this)[i];
+}
+
+template<typename T>
+typename ft::concurrent_vector<T>::const_reference
+ft::concurrent_vector<T>::at(size_type i) const {
+	if (i >= size())
+		throw std::out_of_range("ft::concurrent_vector: index out of range");
+	return (*this)[i];
+}
+
+//Modifiers:
+template<typename T>
+typename ft::concurrent_vector<T>::size_type
+ft::concurrent_vector<T>::grow_by(size_type n, const value_type &val) {
+	size_type first = claim(n);
+
+	for (size_type i = first; i < first + n; i++)
+		construct(i, val);
+	return first;
+}
+
+template<typename T>
+template<typename ForwardIterator>
+typename ft::concurrent_vector<T>::size_type
+ft::concurrent_vector<T>::grow_by(
+		ForwardIterator first,
+		typename IsInputIter<ForwardIterator>::type last) {
+	size_type n = 0;
+	size_type i;
+
+	for (ForwardIterator it = first; it != last; ++it)
+		n++;
+	i = claim(n);
+	for (size_type j = i; first != last; ++first, ++j)
+		construct(j, *first);
+	return i;
+}
+
+template<typename T>
+ft::vector<T> ft::concurrent_vector<T>::compact(void) const {
+	size_type n = size();
+	vector<T> out;
+
+	out.reserve(n);
+	for (size_type k = 0; segment_start(k) < n; k++) {
+		const T *data = slot(segment(k), k, segment_start(k));
+		size_type end = segment_start(k + 1) < n ? segment_start(k + 1) : n;
+		out.insert(out.end(), data, data + (end - segment_start(k)));
+	}
+	return out;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_CONCURRENT_VECTOR_HPP
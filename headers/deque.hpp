@@ -0,0 +1,644 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_DEQUE_HPP
+#define FT_CONTAINERS_FINAL_DEQUE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <cstdio>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+namespace ft {
+const std::string DEQUE_OOR_MSG =
+		"deque::at: n (which is %lu) >= this->size() (which is %lu)";
+
+//ft::deque: elements live in fixed-size blocks reached through a map of
+//block pointers. Growing at either end only allocates a new block or
+//reallocates the map, elements themselves are never moved.
+//Element i of the deque is at position head + i, block (head + i) / block_size.
+template<typename T, typename Allocator = std::allocator<T> >
+class deque {
+	template<bool IsConst>
+	struct common_iterator;
+
+public:
+	typedef T value_type;
+	typedef Allocator allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef typename allocator_type::size_type size_type;
+
+	typedef deque::common_iterator<NotConst> iterator;
+	typedef deque::common_iterator<Const> const_iterator;
+	typedef common_reverse_iterator<iterator> reverse_iterator;
+	typedef common_reverse_iterator<const_iterator> const_reverse_iterator;
+
+	//Elements per block: about 4 KB worth, but never less than 16.
+	static const size_type block_size = sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+
+
+private:
+	typedef typename Allocator::template rebind<value_type *>::other map_allocator;
+
+	value_type **map;
+	size_type map_cap;
+	size_type head;
+	size_type len;
+	allocator_type alloc;
+	map_allocator map_alloc;
+
+private:
+	//Utils:
+	value_type &at_pos(size_type pos) const {
+		return map[pos / block_size][pos % block_size];
+	}
+
+	//Makes sure block b exists.
+	void take_block(size_type b) {
+		if (map[b] == NULL)
+			map[b] = alloc.allocate(block_size);
+	}
+
+	void drop_block(size_type b) {
+		alloc.deallocate(map[b], block_size);
+		map[b] = NULL;
+	}
+
+	//Moves the block pointers to the middle of the map, growing it when
+	//there is no free slot left on one of the sides.
+	void recenter(void);
+
+	void destroy(void);
+
+public:
+	deque(const allocator_type &_alloc = allocator_type())
+			: map(NULL), map_cap(0), head(0), len(0), alloc(_alloc) {}
+
+	deque(const size_type n, const value_type &val = value_type(),
+		  const allocator_type &_alloc = allocator_type())
+			: map(NULL), map_cap(0), head(0), len(0), alloc(_alloc) {
+		assign(n, val);
+	}
+
+	template<class InputIterator>
+	deque(InputIterator first, typename IsInputIter<InputIterator>::type last,
+		  const allocator_type &_alloc = allocator_type())
+			: map(NULL), map_cap(0), head(0), len(0), alloc(_alloc) {
+		assign(first, last);
+	}
+
+	deque(const deque &inst)
+			: map(NULL), map_cap(0), head(0), len(0), alloc(inst.alloc) {
+		*this = inst;
+	}
+
+	~deque(void);
+
+	deque &operator=(const deque &inst);
+
+#if __cplusplus >= 201103L
+	deque(deque &&inst) noexcept
+			: map(NULL), map_cap(0), head(0), len(0), alloc(inst.alloc) {
+		swap(inst);
+	}
+
+	deque &operator=(deque &&inst) noexcept {
+		if (this != &inst) {
+			clear();
+			swap(inst);
+		}
+		return (*this);
+	}
+#endif
+
+	//Iterators:
+	iterator begin(void) { return iterator(map, head); }
+
+	const_iterator begin(void) const { return const_iterator(map, head); }
+
+	iterator end(void) { return iterator(map, head + len); }
+
+	const_iterator end(void) const { return const_iterator(map, head + len); }
+
+	reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin(void) const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend(void) { return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend(void) const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin(void) const { return begin(); }
+
+	const_iterator cend(void) const { return end(); }
+
+	const_reverse_iterator crbegin(void) const { return rbegin(); }
+
+	const_reverse_iterator crend(void) const { return rend(); }
+
+	//Element access:
+	reference operator[](const size_type i) { return at_pos(head + i); }
+
+	const_reference operator[](const size_type i) const {
+		return at_pos(head + i);
+	}
+
+	reference at(const size_type n);
+
+	const_reference at(const size_type n) const;
+
+	reference front(void) { return at_pos(head); }
+
+	const_reference front(void) const { return at_pos(head); }
+
+	reference back(void) { return at_pos(head + len - 1); }
+
+	const_reference back(void) const { return at_pos(head + len - 1); }
+
+	//Capacity:
+	size_type size(void) const { return len; }
+
+	size_type max_size(void) const { return alloc.max_size(); }
+
+	void resize(const size_type n, const value_type &val = value_type());
+
+	bool empty(void) const { return len == 0; }
+
+	//Modifiers:
+	template<typename InputIterator>
+	typename IsInputIter<InputIterator, ft::setVoid>::type
+	assign(InputIterator first, InputIterator last);
+
+	void assign(const size_type n, const value_type &val);
+
+	void push_back(const value_type &value);
+
+	void push_front(const value_type &value);
+
+	void pop_back(void);
+
+	void pop_front(void);
+
+#if __cplusplus >= 201103L
+	void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+	void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+	template<typename... Args>
+	void emplace_back(Args &&... args);
+
+	template<typename... Args>
+	void emplace_front(Args &&... args);
+#endif
+
+	iterator insert(iterator position, const value_type &val);
+
+	void insert(iterator position, size_t n, const value_type &val);
+
+	template<typename InputIterator>
+	void insert(iterator position, InputIterator first,
+				typename IsInputIter<InputIterator>::type last);
+
+	iterator erase(iterator position);
+
+	iterator erase(iterator first, iterator last);
+
+	allocator_type get_allocator(void) const { return alloc; }
+
+	void swap(deque &x);
+
+	void clear(void);
+
+};
+
+//Compaire operators:
+template<typename T, typename Allocator>
+bool operator==(const deque<T, Allocator> &f, const deque<T, Allocator> &s) {
+	return equal(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T, typename Allocator>
+bool operator!=(const deque<T, Allocator> &f, const deque<T, Allocator> &s) {
+	return !(f == s);
+}
+
+template<typename T, typename Allocator>
+bool operator<(const deque<T, Allocator> &f, const deque<T, Allocator> &s) {
+	return ft::lexicographical_compare(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T, typename Allocator>
+bool operator<=(const deque<T, Allocator> &f, const deque<T, Allocator> &s) {
+	return (f < s) || (f == s);
+}
+
+template<typename T, typename Allocator>
+bool operator>(const deque<T, Allocator> &f, const deque<T, Allocator> &s) {
+	return !(f < s) && (f != s);
+}
+
+template<typename T, typename Allocator>
+bool operator>=(const deque<T, Allocator> &f, const deque<T, Allocator> &s) {
+	return (f > s) || (f == s);
+}
+
+//std::swap:
+template<typename T, typename Allocator>
+void swap(deque<T, Allocator> &f, deque<T, Allocator> &s) { f.swap(s); }
+
+template<typename T, typename Allocator>
+ft::deque<T, Allocator>::~deque(void) {
+	clear();
+	if (map)
+		map_alloc.deallocate(map, map_cap);
+}
+
+template<typename T, typename Allocator>
+ft::deque<T, Allocator> &ft::deque<T, Allocator>::operator=(const deque &inst) {
+	if (this == &inst)
+		return (*this);
+	clear();
+	for (size_type i = 0; i < inst.len; i++)
+		push_back(inst[i]);
+	return (*this);
+}
+
+//Utils:
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::recenter(void) {
+	size_type lo = head / block_size;
+	size_type used = 0;
+	size_type newcap = map_cap;
+	size_type newlo;
+	value_type **tmp = map;
+
+	if (len)
+		used = (head + len - 1) / block_size - lo + 1;
+	else if (lo < map_cap && map[lo])
+		used = 1;
+	if (newcap < used + 2 || used * 2 > newcap)
+		newcap = used * 2 + 8 > map_cap * 2 ? used * 2 + 8 : map_cap * 2;
+	newlo = (newcap - used) / 2;
+	if (newcap != map_cap) {
+		tmp = map_alloc.allocate(newcap);
+		std::memset(tmp, 0, newcap * sizeof(*tmp));
+		if (used)
+			std::memcpy(tmp + newlo, map + lo, used * sizeof(*tmp));
+		if (map)
+			map_alloc.deallocate(map, map_cap);
+	} else {
+		std::memmove(tmp + newlo, map + lo, used * sizeof(*tmp));
+		if (newlo > lo)
+			std::memset(tmp + lo, 0, (newlo - lo) * sizeof(*tmp));
+		else
+			std::memset(tmp + newlo + used, 0, (lo - newlo) * sizeof(*tmp));
+	}
+	map = tmp;
+	map_cap = newcap;
+	head = newlo * block_size + head % block_size;
+}
+
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::destroy(void) {
+	while (len)
+		pop_back();
+}
+
+//Element acsses:
+template<typename T, typename Allocator>
+typename ft::deque<T, Allocator>::reference
+ft::deque<T, Allocator>::at(const size_type n) {
+	if (n < len)
+		return (*this)[n];
+	char err[128];
+	snprintf(err, 128, DEQUE_OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+template<typename T, typename Allocator>
+typename ft::deque<T, Allocator>::const_reference
+ft::deque<T, Allocator>::at(const size_type n) const {
+	if (n < len)
+		return (*this)[n];
+	char err[128];
+	snprintf(err, 128, DEQUE_OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+//Capacity:
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::resize(const size_type n, const value_type &val) {
+	while (len > n)
+		pop_back();
+	while (len < n)
+		push_back(val);
+}
+
+//Modifiers:
+template<typename T, typename Allocator>
+template<typename InputIterator>
+typename ft::IsInputIter<InputIterator, ft::setVoid>::type
+ft::deque<T, Allocator>::assign(InputIterator first, InputIterator last) {
+	destroy();
+	while (first != last)
+		push_back(*first++);
+}
+
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::assign(const size_type n, const value_type &val) {
+	destroy();
+	while (len != n)
+		push_back(val);
+}
+
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::push_back(const value_type &value) {
+	if ((head + len) / block_size >= map_cap)
+		recenter();
+	take_block((head + len) / block_size);
+	alloc.construct(&at_pos(head + len), value);
+	len++;
+}
+
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::push_front(const value_type &value) {
+	if (head == 0)
+		recenter();
+	take_block((head - 1) / block_size);
+	alloc.construct(&at_pos(head - 1), value);
+	head--;
+	len++;
+}
+
+#if __cplusplus >= 201103L
+//Elements never move, so args can be forwarded straight into the slot.
+template<typename T, typename Allocator>
+template<typename... Args>
+void ft::deque<T, Allocator>::emplace_back(Args &&... args) {
+	if ((head + len) / block_size >= map_cap)
+		recenter();
+	take_block((head + len) / block_size);
+	std::allocator_traits<allocator_type>::construct(
+			alloc, &at_pos(head + len), std::forward<Args>(args)...);
+	len++;
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void ft::deque<T, Allocator>::emplace_front(Args &&... args) {
+	if (head == 0)
+		recenter();
+	take_block((head - 1) / block_size);
+	std::allocator_traits<allocator_type>::construct(
+			alloc, &at_pos(head - 1), std::forward<Args>(args)...);
+	head--;
+	len++;
+}
+#endif
+
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::pop_back(void) {
+	size_type pos;
+
+	if (len == 0)
+		return;
+	pos = head + --len;
+	alloc.destroy(&at_pos(pos));
+	if (pos % block_size == 0)
+		drop_block(pos / block_size);
+}
+
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::pop_front(void) {
+	if (len == 0)
+		return;
+	alloc.destroy(&at_pos(head));
+	head++;
+	len--;
+	if (head % block_size == 0)
+		drop_block(head / block_size - 1);
+}
+
+template<typename T, typename Allocator>
+typename ft::deque<T, Allocator>::iterator
+ft::deque<T, Allocator>::insert(iterator position, const value_type &val) {
+	size_type i = position.base() - head;
+
+	insert(position, 1, val);
+	return begin() + i;
+}
+
+//Opens the gap on the side with fewer elements to shift.
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::insert(
+		iterator position, size_t n, const value_type &val) {
+	size_type i = position.base() - head;
+	value_type tmp(val);
+
+	if (n == 0)
+		return;
+	if (i < len - i) {
+		for (size_type k = 0; k < n; k++)
+			push_front(tmp);
+		for (size_type k = 0; k < i; k++)
+			(*this)[k] = (*this)[k + n];
+	} else {
+		for (size_type k = 0; k < n; k++)
+			push_back(tmp);
+		for (size_type k = len - n; k > i; k--)
+			(*this)[k - 1 + n] = (*this)[k - 1];
+	}
+	for (size_type k = i; k < i + n; k++)
+		(*this)[k] = tmp;
+}
+
+template<typename T, typename Allocator>
+template<typename InputIterator>
+void ft::deque<T, Allocator>::insert(
+		iterator position, InputIterator first,
+		typename IsInputIter<InputIterator>::type last) {
+	size_type i = position.base() - head;
+	vector<value_type> tmp(first, last);
+	size_type n = tmp.size();
+
+	if (n == 0)
+		return;
+	if (i < len - i) {
+		for (size_type k = 0; k < n; k++)
+			push_front(tmp[0]);
+		for (size_type k = 0; k < i; k++)
+			(*this)[k] = (*this)[k + n];
+	} else {
+		for (size_type k = 0; k < n; k++)
+			push_back(tmp[0]);
+		for (size_type k = len - n; k > i; k--)
+			(*this)[k - 1 + n] = (*this)[k - 1];
+	}
+	for (size_type k = 0; k < n; k++)
+		(*this)[i + k] = tmp[k];
+}
+
+template<typename T, typename Allocator>
+typename ft::deque<T, Allocator>::iterator
+ft::deque<T, Allocator>::erase(iterator position) {
+	return erase(position, position + 1);
+}
+
+//Closes the gap from the side with fewer elements to shift.
+template<typename T, typename Allocator>
+typename ft::deque<T, Allocator>::iterator
+ft::deque<T, Allocator>::erase(iterator first, iterator last) {
+	size_type i = first.base() - head;
+	size_type n = last.base() - first.base();
+
+	if (last.base() < first.base())
+		throw std::out_of_range("ft::deque::erase: iterator out of range");
+	if (i < len - i - n) {
+		for (size_type k = i; k > 0; k--)
+			(*this)[k - 1 + n] = (*this)[k - 1];
+		for (size_type k = 0; k < n; k++)
+			pop_front();
+	} else {
+		for (size_type k = i + n; k < len; k++)
+			(*this)[k - n] = (*this)[k];
+		for (size_type k = 0; k < n; k++)
+			pop_back();
+	}
+	return begin() + i;
+}
+
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::swap(deque &x) {
+	if (this == &x)
+		return;
+
+	value_type **xmap = x.map;
+	size_type xmap_cap = x.map_cap;
+	size_type xhead = x.head;
+	size_type xlen = x.len;
+
+	x.map = map;
+	x.map_cap = map_cap;
+	x.head = head;
+	x.len = len;
+
+	map = xmap;
+	map_cap = xmap_cap;
+	head = xhead;
+	len = xlen;
+}
+
+template<typename T, typename Allocator>
+void ft::deque<T, Allocator>::clear(void) {
+	destroy();
+	if (head / block_size < map_cap && map[head / block_size])
+		drop_block(head / block_size);
+}
+
+
+template<typename T, typename Allocator>
+template<bool IsConst>
+struct ft::deque<T, Allocator>::common_iterator
+		: public iterator_base<std::random_access_iterator_tag,
+				typename conditional<IsConst, value_type, const value_type>::type> {
+	typedef
+	typename common_iterator::iterator_base::difference_type diff_t;
+
+	typedef
+	typename conditional_t<IsConst, value_type, const value_type>::type value_t;
+
+	typedef
+	typename conditional_t<IsConst, iterator, const_iterator>::type iter_t;
+
+private:
+	value_type **blocks;
+	size_type pos;
+
+public:
+	common_iterator(void) : blocks(NULL), pos(0) {}
+
+	common_iterator(value_type **_blocks, size_type _pos)
+			: blocks(_blocks), pos(_pos) {}
+
+	common_iterator(const iterator &inst)
+			: blocks(inst.blocksBase()), pos(inst.base()) {}
+
+	~common_iterator(void) {}
+
+	iter_t &operator=(const iterator &inst) {
+		blocks = inst.blocksBase();
+		pos = inst.base();
+		return *this;
+	}
+
+	iter_t operator+(diff_t n) const { return iter_t(blocks, pos + n); }
+
+	iter_t operator-(diff_t n) const { return iter_t(blocks, pos - n); }
+
+	template<bool C>
+	diff_t operator-(const common_iterator<C> &rhs) const {
+		return static_cast<diff_t>(pos) - static_cast<diff_t>(rhs.base());
+	}
+
+	iter_t &operator+=(diff_t n) {
+		pos += n;
+		return *this;
+	}
+
+	iter_t &operator-=(diff_t n) {
+		pos -= n;
+		return *this;
+	}
+
+	iter_t &operator++(void) {
+		++pos;
+		return *this;
+	}
+
+	iter_t operator++(int) { return iter_t(blocks, pos++); }
+
+	iter_t &operator--(void) {
+		--pos;
+		return *this;
+	}
+
+	iter_t operator--(int) { return iter_t(blocks, pos--); }
+
+	value_t &operator*(void) const {
+		return blocks[pos / block_size][pos % block_size];
+	}
+
+	value_t *operator->(void) const { return &**this; }
+
+	value_t &operator[](diff_t n) const { return *(*this + n); }
+
+	//Position in the map, used by the common comparison operators.
+	size_type base(void) const { return pos; }
+
+	value_type **blocksBase(void) const { return blocks; }
+
+	void swap(iter_t &rhs) {
+		iter_t tmp = *this;
+		*this = rhs;
+		rhs = tmp;
+	}
+};
+}
+
+#endif //FT_CONTAINERS_FINAL_DEQUE_HPP
@@ -0,0 +1,544 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_DEVECTOR_HPP
+#define FT_CONTAINERS_FINAL_DEVECTOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <cstdio>
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+namespace ft {
+//ft::devector: contiguous storage with spare capacity on both sides, the
+//elements are [arr + off, arr + off + len). push_front and push_back are
+//amortized O(1), middle inserts and erases move the shorter side.
+//Iterators are the ft::vector<T, Allocator> ones.
+template<typename T, typename Allocator = std::allocator<T> >
+class devector {
+public:
+	typedef T value_type;
+	typedef Allocator allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef typename allocator_type::size_type size_type;
+
+	typedef typename vector<T, Allocator>::iterator iterator;
+	typedef typename vector<T, Allocator>::const_iterator const_iterator;
+	typedef common_reverse_iterator<iterator> reverse_iterator;
+	typedef common_reverse_iterator<const_iterator> const_reverse_iterator;
+
+
+private:
+	value_type *arr;
+	size_type cap;
+	size_type off;
+	size_type len;
+	allocator_type alloc;
+
+private:
+	//Utils:
+	value_type *first(void) const { return arr + off; }
+
+	//Guarantees front_n free slots before and back_n after the elements.
+	void make_room(size_type front_n, size_type back_n);
+
+	void relocate(size_type newcap, size_type newoff);
+
+	void slide(size_type newoff);
+
+	void destroy(void);
+
+public:
+	devector(const allocator_type &_alloc = allocator_type())
+			: arr(NULL), cap(0), off(0), len(0), alloc(_alloc) {}
+
+	devector(const size_type n, const value_type &val = value_type(),
+			 const allocator_type &_alloc = allocator_type())
+			: arr(NULL), cap(0), off(0), len(0), alloc(_alloc) { assign(n, val); }
+
+	template<class InputIterator>
+	devector(InputIterator first,
+			 typename IsInputIter<InputIterator>::type last,
+			 const allocator_type &_alloc = allocator_type())
+			: arr(NULL), cap(0), off(0), len(0), alloc(_alloc) {
+		assign(first, last);
+	}
+
+	devector(const devector &inst)
+			: arr(NULL), cap(0), off(0), len(0), alloc(inst.alloc) {
+		*this = inst;
+	}
+
+	~devector(void) { clear(); }
+
+	devector &operator=(const devector &inst);
+
+	//Iterators:
+	iterator begin(void) { return iterator(first()); }
+
+	const_iterator begin(void) const { return const_iterator(first()); }
+
+	iterator end(void) { return iterator(first() + len); }
+
+	const_iterator end(void) const { return const_iterator(first() + len); }
+
+	reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin(void) const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend(void) { return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend(void) const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin(void) const { return begin(); }
+
+	const_iterator cend(void) const { return end(); }
+
+	const_reverse_iterator crbegin(void) const { return rbegin(); }
+
+	const_reverse_iterator crend(void) const { return rend(); }
+
+	//Element access:
+	reference operator[](const size_type i) { return first()[i]; }
+
+	const_reference operator[](const size_type i) const { return first()[i]; }
+
+	reference at(const size_type n);
+
+	const_reference at(const size_type n) const;
+
+	reference front(void) { return *first(); }
+
+	const_reference front(void) const { return *first(); }
+
+	reference back(void) { return first()[len - 1]; }
+
+	const_reference back(void) const { return first()[len - 1]; }
+
+	value_type *data(void) { return first(); }
+
+	const value_type *data(void) const { return first(); }
+
+	//Capacity:
+	size_type size(void) const { return len; }
+
+	size_type max_size(void) const { return alloc.max_size(); }
+
+	void resize(const size_type n, const value_type &val = value_type());
+
+	size_type capacity(void) const { return cap; }
+
+	size_type front_free_capacity(void) const { return off; }
+
+	size_type back_free_capacity(void) const { return cap - off - len; }
+
+	bool empty(void) const { return len == 0; }
+
+	//Makes room for n elements, the spare goes behind the elements.
+	void reserve(const size_type n) {
+		if (n <= len + back_free_capacity()) return;
+		make_room(0, n - len);
+	}
+
+	void reserve_front(const size_type n) {
+		if (n <= len + off) return;
+		make_room(n - len, 0);
+	}
+
+	void shrink_to_fit(void) {
+		if (len == cap) return;
+		relocate(len, 0);
+	}
+
+	//Modifiers:
+	template<typename InputIterator>
+	typename IsInputIter<InputIterator, ft::setVoid>::type
+	assign(InputIterator first, InputIterator last);
+
+	void assign(const size_type n, const value_type &val);
+
+	void push_back(const value_type &value);
+
+	void push_front(const value_type &value);
+
+	void pop_back(void) { if (len) alloc.destroy(&first()[--len]); }
+
+	void pop_front(void) {
+		if (len == 0) return;
+		alloc.destroy(first());
+		off++;
+		len--;
+	}
+
+	iterator insert(iterator position, const value_type &val);
+
+	void insert(iterator position, size_t n, const value_type &val);
+
+	template<typename InputIterator>
+	void insert(iterator position, InputIterator first,
+				typename IsInputIter<InputIterator>::type last);
+
+	iterator erase(iterator position);
+
+	iterator erase(iterator first, iterator last);
+
+	allocator_type get_allocator(void) const { return alloc; }
+
+	void swap(devector &x);
+
+	void clear(void);
+
+};
+
+//Compaire operators:
+template<typename T, typename Allocator>
+bool operator==(const devector<T, Allocator> &f,
+				const devector<T, Allocator> &s) {
+	return equal(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T, typename Allocator>
+bool operator!=(const devector<T, Allocator> &f,
+				const devector<T, Allocator> &s) {
+	return !(f == s);
+}
+
+template<typename T, typename Allocator>
+bool operator<(const devector<T, Allocator> &f,
+			   const devector<T, Allocator> &s) {
+	return ft::lexicographical_compare(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T, typename Allocator>
+bool operator<=(const devector<T, Allocator> &f,
+				const devector<T, Allocator> &s) {
+	return (f < s) || (f == s);
+}
+
+template<typename T, typename Allocator>
+bool operator>(const devector<T, Allocator> &f,
+			   const devector<T, Allocator> &s) {
+	return !(f < s) && (f != s);
+}
+
+template<typename T, typename Allocator>
+bool operator>=(const devector<T, Allocator> &f,
+				const devector<T, Allocator> &s) {
+	return (f > s) || (f == s);
+}
+
+//std::swap:
+template<typename T, typename Allocator>
+void swap(devector<T, Allocator> &f, devector<T, Allocator> &s) { f.swap(s); }
+
+template<typename T, typename Allocator>
+ft::devector<T, Allocator> &ft::devector<T, Allocator>::operator=(
+		const devector &inst) {
+	if (this == &inst)
+		return (*this);
+	destroy();
+	if (cap < inst.len)
+		relocate(inst.len, 0);
+	off = 0;
+	for (size_t i = 0; i < inst.len; i++) {
+		alloc.construct(&arr[i], inst[i]);
+		len++;
+	}
+	return (*this);
+}
+
+//Utils:
+//A side that ran out gets three quarters of the new spare. When at least
+//half of the buffer is free the elements just slide inside it, so a
+//sliding window (push_back + pop_front) does not grow the buffer forever.
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::make_room(size_type front_n, size_type back_n) {
+	size_type need = len + front_n + back_n;
+	size_type newcap = cap;
+	size_type spare;
+	size_type front_spare;
+
+	if (off >= front_n && cap - off - len >= back_n)
+		return;
+	if (need * 2 > cap)
+		newcap = need > cap * 2 ? need : cap * 2;
+	if (newcap < 8)
+		newcap = 8;
+	spare = newcap - need;
+	if (front_n > back_n)
+		front_spare = spare - spare / 4;
+	else if (back_n > front_n)
+		front_spare = spare / 4;
+	else
+		front_spare = spare / 2;
+	if (newcap == cap)
+		slide(front_n + front_spare);
+	else
+		relocate(newcap, front_n + front_spare);
+}
+
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::relocate(size_type newcap, size_type newoff) {
+	value_type *tmp;
+
+	tmp = alloc.allocate(newcap);
+	for (size_t i = 0; i < len; i++) {
+		try {
+			alloc.construct(&tmp[newoff + i], first()[i]);
+		}
+		catch (...) {
+			for (size_t j = 0; j < i; j++)
+				alloc.destroy(&tmp[newoff + j]);
+			alloc.deallocate(tmp, newcap);
+			throw;
+		}
+	}
+	for (size_t i = 0; i < len; i++)
+		alloc.destroy(&first()[i]);
+	if (arr)
+		alloc.deallocate(arr, cap);
+	arr = tmp;
+	cap = newcap;
+	off = newoff;
+}
+
+//Moves the elements inside the current buffer so they start at newoff.
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::slide(size_type newoff) {
+	if (newoff < off) {
+		for (size_t i = 0; i < len; i++) {
+			alloc.construct(&arr[newoff + i], arr[off + i]);
+			alloc.destroy(&arr[off + i]);
+		}
+	} else if (newoff > off) {
+		for (size_t i = len; i > 0; i--) {
+			alloc.construct(&arr[newoff + i - 1], arr[off + i - 1]);
+			alloc.destroy(&arr[off + i - 1]);
+		}
+	}
+	off = newoff;
+}
+
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::destroy(void) {
+	for (size_t i = 0; i < len; i++)
+		alloc.destroy(&first()[i]);
+	len = 0;
+}
+
+//Element acsses:
+template<typename T, typename Allocator>
+typename ft::devector<T, Allocator>::reference
+ft::devector<T, Allocator>::at(const size_type n) {
+	if (n < len)
+		return first()[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+template<typename T, typename Allocator>
+typename ft::devector<T, Allocator>::const_reference
+ft::devector<T, Allocator>::at(const size_type n) const {
+	if (n < len)
+		return first()[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+//Capacity:
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::resize(const size_type n, const value_type &val) {
+	while (len > n)
+		pop_back();
+	if (n > len)
+		insert(end(), n - len, val);
+}
+
+//Modifiers:
+template<typename T, typename Allocator>
+template<typename InputIterator>
+typename ft::IsInputIter<InputIterator, ft::setVoid>::type
+ft::devector<T, Allocator>::assign(InputIterator first, InputIterator last) {
+	destroy();
+	off = 0;
+	while (first != last)
+		push_back(*first++);
+}
+
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::assign(const size_type n, const value_type &val) {
+	destroy();
+	off = 0;
+	insert(end(), n, val);
+}
+
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::push_back(const value_type &value) {
+	if (off + len == cap) {
+		value_type tmp(value);
+		make_room(0, 1);
+		alloc.construct(&first()[len++], tmp);
+		return;
+	}
+	alloc.construct(&first()[len], value);
+	len++;
+}
+
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::push_front(const value_type &value) {
+	if (off == 0) {
+		value_type tmp(value);
+		make_room(1, 0);
+		alloc.construct(&arr[off - 1], tmp);
+	} else {
+		alloc.construct(&arr[off - 1], value);
+	}
+	off--;
+	len++;
+}
+
+template<typename T, typename Allocator>
+typename ft::devector<T, Allocator>::iterator
+ft::devector<T, Allocator>::insert(iterator position, const value_type &val) {
+	size_t i = position.base() - first();
+
+	insert(position, 1, val);
+	return begin() + i;
+}
+
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::insert(
+		iterator position, size_t n, const value_type &val) {
+	size_t i = position.base() - first();
+	value_type tmp(val);
+
+	if (n == 0)
+		return;
+	if (i < len - i) {
+		make_room(n, 0);
+		for (size_t k = 0; k < i; k++) {
+			alloc.construct(&arr[off - n + k], arr[off + k]);
+			alloc.destroy(&arr[off + k]);
+		}
+		off -= n;
+	} else {
+		make_room(0, n);
+		for (size_t k = len; k > i; k--) {
+			alloc.construct(&arr[off + k - 1 + n], arr[off + k - 1]);
+			alloc.destroy(&arr[off + k - 1]);
+		}
+	}
+	for (size_t k = 0; k < n; k++)
+		alloc.construct(&arr[off + i + k], tmp);
+	len += n;
+}
+
+template<typename T, typename Allocator>
+template<typename InputIterator>
+void ft::devector<T, Allocator>::insert(
+		iterator position, InputIterator first,
+		typename IsInputIter<InputIterator>::type last) {
+	size_t i = position.base() - this->first();
+	vector<value_type, Allocator> tmp(first, last);
+	size_t n = tmp.size();
+
+	if (n == 0)
+		return;
+	if (i < len - i) {
+		make_room(n, 0);
+		for (size_t k = 0; k < i; k++) {
+			alloc.construct(&arr[off - n + k], arr[off + k]);
+			alloc.destroy(&arr[off + k]);
+		}
+		off -= n;
+	} else {
+		make_room(0, n);
+		for (size_t k = len; k > i; k--) {
+			alloc.construct(&arr[off + k - 1 + n], arr[off + k - 1]);
+			alloc.destroy(&arr[off + k - 1]);
+		}
+	}
+	for (size_t k = 0; k < n; k++)
+		alloc.construct(&arr[off + i + k], tmp[k]);
+	len += n;
+}
+
+template<typename T, typename Allocator>
+typename ft::devector<T, Allocator>::iterator
+ft::devector<T, Allocator>::erase(iterator position) {
+	return erase(position, position + 1);
+}
+
+template<typename T, typename Allocator>
+typename ft::devector<T, Allocator>::iterator
+ft::devector<T, Allocator>::erase(iterator first, iterator last) {
+	size_t i = first.base() - this->first();
+	size_t n = last.base() - first.base();
+
+	if (last.base() < first.base())
+		throw std::out_of_range("ft::devector::erase: iterator out of range");
+	for (size_t k = i; k < i + n; k++)
+		alloc.destroy(&arr[off + k]);
+	if (i < len - i - n) {
+		for (size_t k = i; k > 0; k--) {
+			alloc.construct(&arr[off + k - 1 + n], arr[off + k - 1]);
+			alloc.destroy(&arr[off + k - 1]);
+		}
+		off += n;
+	} else {
+		for (size_t k = i + n; k < len; k++) {
+			alloc.construct(&arr[off + k - n], arr[off + k]);
+			alloc.destroy(&arr[off + k]);
+		}
+	}
+	len -= n;
+	return begin() + i;
+}
+
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::swap(devector &x) {
+	if (this == &x)
+		return;
+
+	value_type *xarr = x.arr;
+	size_type xcap = x.cap;
+	size_type xoff = x.off;
+	size_type xlen = x.len;
+
+	x.arr = arr;
+	x.cap = cap;
+	x.off = off;
+	x.len = len;
+
+	arr = xarr;
+	cap = xcap;
+	off = xoff;
+	len = xlen;
+}
+
+template<typename T, typename Allocator>
+void ft::devector<T, Allocator>::clear(void) {
+	destroy();
+	if (arr)
+		alloc.deallocate(arr, cap);
+	arr = NULL;
+	cap = 0;
+	off = 0;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_DEVECTOR_HPP
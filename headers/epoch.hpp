@@ -0,0 +1,227 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_EPOCH_HPP
+#define FT_CONTAINERS_FINAL_EPOCH_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "vector.hpp"
+#include "atomic.hpp"
+
+namespace ft {
+//ft::epoch_domain: epoch based reclamation for the lock-free containers.
+//Readers run inside an epoch_guard. A node unlinked from a structure is
+//retired instead of deleted: it is freed once the global epoch has moved
+//on twice, because every guard that could still hold a pointer to it must
+//have ended by then. The epoch moves on when every thread inside a guard
+//has seen the current one, so a guard held forever only delays frees.
+//There is one domain per process, and a thread record is reused by the
+//next thread after its owner exits.
+class epoch_domain {
+public:
+	typedef void (*deleter)(void *);
+
+private:
+	struct retired {
+		void *ptr;
+		deleter del;
+	};
+
+	//What one thread retired while the global epoch was epoch.
+	struct bag {
+		uint64_t epoch;
+		vector<retired> items;
+
+		bag(void): epoch(0) {}
+	};
+
+	struct record {
+		//(epoch << 1 | 1) inside a guard, 0 outside.
+		uint64_t state;
+		char pad[cache_line - sizeof(uint64_t)];
+		unsigned int nest;
+		unsigned int retires;
+		int in_use;
+		record *next;
+		bag bags[3];
+
+		record(void): state(0), nest(0), retires(0), in_use(1), next(NULL) {}
+	};
+
+	static const unsigned int retires_per_scan = 64;
+
+	uint64_t global;
+	char pad[cache_line - sizeof(uint64_t)];
+	record *records;
+	pthread_key_t key;
+
+	epoch_domain(void): global(2), records(NULL) {
+		pthread_key_create(&key, release);
+	}
+
+	static void release(void *rec) {
+		__atomic_store_n(&static_cast<record *>(rec)->in_use, 0,
+						 __ATOMIC_RELEASE);
+	}
+
+	record *self(void);
+
+	static void free_bag(bag &b) {
+		for (size_t i = 0; i < b.items.size(); i++)
+			b.items[i].del(b.items[i].ptr);
+		b.items.clear();
+	}
+
+	void collect(record *rec, uint64_t now) {
+		for (size_t i = 0; i < 3; i++)
+			if (rec->bags[i].epoch + 2 <= now)
+				free_bag(rec->bags[i]);
+	}
+
+	epoch_domain(const epoch_domain &);
+
+	epoch_domain &operator=(const epoch_domain &);
+
+public:
+	//Never destroyed: static destructors may still retire.
+	static epoch_domain &instance(void) {
+		static epoch_domain *domain = new epoch_domain();
+
+		return *domain;
+	}
+
+	void enter(void);
+
+	void leave(void);
+
+	//p is passed to del once no guard can reach it any more. The caller
+	//has made p unreachable for new readers before.
+	void retire(void *p, deleter del);
+
+	//Moves the epoch on if every thread in a guard has seen it.
+	bool try_advance(void);
+
+	//Frees what this thread retired, as far as the epoch allows.
+	void reclaim(void);
+};
+
+//ft::epoch_guard: the calling thread stays in the current epoch while a
+//guard lives. Guards nest and copy, but must not leave the thread.
+class epoch_guard {
+public:
+	epoch_guard(void) { epoch_domain::instance().enter(); }
+
+	epoch_guard(const epoch_guard &) { epoch_domain::instance().enter(); }
+
+	~epoch_guard(void) { epoch_domain::instance().leave(); }
+
+	epoch_guard &operator=(const epoch_guard &) { return *this; }
+};
+
+template<typename T>
+void epoch_delete(void *p) { delete static_cast<T *>(p); }
+
+//Retires an object allocated with new.
+template<typename T>
+void epoch_retire(T *p) {
+	epoch_domain::instance().retire(p, epoch_delete<T>);
+}
+}
+
+//Utils:
+inline ft::epoch_domain::record *ft::epoch_domain::self(void) {
+	static __thread record *rec = NULL;
+	record *head;
+
+	if (rec)
+		return rec;
+	for (record *r = __atomic_load_n(&records, __ATOMIC_ACQUIRE); r;
+		 r = r->next) {
+		int expected = 0;
+		if (__atomic_compare_exchange_n(&r->in_use, &expected, 1, false,
+										__ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+			rec = r;
+			break;
+		}
+	}
+	if (!rec) {
+		rec = new record();
+		head = __atomic_load_n(&records, __ATOMIC_RELAXED);
+		do
+			rec->next = head;
+		while (!__atomic_compare_exchange_n(&records, &head, rec, false,
+											__ATOMIC_RELEASE,
+											__ATOMIC_RELAXED));
+	}
+	pthread_setspecific(key, rec);
+	return rec;
+}
+
+inline void ft::epoch_domain::enter(void) {
+	record *rec = self();
+
+	if (rec->nest++)
+		return;
+	//The state has to be visible before the guard reads any pointer: a
+	//seq_cst exchange is a full barrier (xchg on x86).
+	__atomic_exchange_n(&rec->state,
+						__atomic_load_n(&global, __ATOMIC_ACQUIRE) << 1 | 1,
+						__ATOMIC_SEQ_CST);
+}
+
+inline void ft::epoch_domain::leave(void) {
+	record *rec = self();
+
+	if (--rec->nest == 0)
+		__atomic_store_n(&rec->state, 0, __ATOMIC_RELEASE);
+}
+
+inline void ft::epoch_domain::retire(void *p, deleter del) {
+	record *rec = self();
+	uint64_t now = __atomic_load_n(&global, __ATOMIC_SEQ_CST);
+	bag &b = rec->bags[now % 3];
+	retired item;
+
+	//A bag three epochs old is free to go.
+	if (b.epoch != now) {
+		free_bag(b);
+		b.epoch = now;
+	}
+	item.ptr = p;
+	item.del = del;
+	b.items.push_back(item);
+	if (++rec->retires >= retires_per_scan) {
+		rec->retires = 0;
+		try_advance();
+		collect(rec, __atomic_load_n(&global, __ATOMIC_ACQUIRE));
+	}
+}
+
+inline bool ft::epoch_domain::try_advance(void) {
+	uint64_t now = __atomic_load_n(&global, __ATOMIC_SEQ_CST);
+
+	for (record *r = __atomic_load_n(&records, __ATOMIC_ACQUIRE); r;
+		 r = r->next) {
+		uint64_t state = __atomic_load_n(&r->state, __ATOMIC_SEQ_CST);
+		if ((state & 1) && (state >> 1) != now)
+			return false;
+	}
+	return __atomic_compare_exchange_n(&global, &now, now + 1, false,
+									   __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+inline void ft::epoch_domain::reclaim(void) {
+	record *rec = self();
+
+	//Two advances free everything retired before the call, unless a
+	//guard is held somewhere.
+	for (int i = 0; i < 2; i++)
+		try_advance();
+	collect(rec, __atomic_load_n(&global, __ATOMIC_ACQUIRE));
+}
+
+#endif //FT_CONTAINERS_FINAL_EPOCH_HPP
@@ -0,0 +1,536 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_INCREMENTAL_VECTOR_HPP
+#define FT_CONTAINERS_FINAL_INCREMENTAL_VECTOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <cstdio>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+namespace ft {
+//ft::incremental_vector: a vector for latency-sensitive code. When it
+//runs out of room it allocates the doubled buffer but leaves the elements
+//where they are; every following push_back then moves migrate_step of
+//them over. No single push_back copies the whole array.
+//While a migration runs, elements [moved, oldlen) still live in the old
+//buffer and the rest in the new one, operator[] picks the right one.
+//Iterators hold an index, so they survive growth.
+template<typename T, typename Allocator = std::allocator<T> >
+class incremental_vector {
+	template<bool IsConst>
+	struct common_iterator;
+
+public:
+	typedef T value_type;
+	typedef Allocator allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef typename allocator_type::size_type size_type;
+
+	typedef incremental_vector::common_iterator<NotConst> iterator;
+	typedef incremental_vector::common_iterator<Const> const_iterator;
+	typedef common_reverse_iterator<iterator> reverse_iterator;
+	typedef common_reverse_iterator<const_iterator> const_reverse_iterator;
+
+	//Elements moved to the new buffer by each push_back. Doubling leaves
+	//room for oldlen more elements, so anything >= 1 finishes in time.
+	static const size_type migrate_step = 2;
+
+
+private:
+	value_type *arr;
+	size_type len;
+	size_type cap;
+	value_type *old;
+	size_type oldcap;
+	size_type oldlen;
+	size_type moved;
+	allocator_type alloc;
+
+private:
+	//Utils:
+	bool in_old(size_type i) const { return i - moved < oldlen - moved; }
+
+	value_type *slot(size_type i) const { return in_old(i) ? old + i : arr + i; }
+
+	//Switches to a buffer of newcap elements, finishing any earlier
+	//migration first.
+	void grow(size_type newcap);
+
+	//Moves up to n elements from the old buffer to the new one.
+	void migrate(size_type n);
+
+	void release_old(void);
+
+	void destroy(void);
+
+public:
+	incremental_vector(const allocator_type &_alloc = allocator_type())
+			: arr(NULL), len(0), cap(0), old(NULL), oldcap(0), oldlen(0),
+			  moved(0), alloc(_alloc) {}
+
+	incremental_vector(const size_type n, const value_type &val = value_type(),
+					   const allocator_type &_alloc = allocator_type())
+			: arr(NULL), len(0), cap(0), old(NULL), oldcap(0), oldlen(0),
+			  moved(0), alloc(_alloc) { assign(n, val); }
+
+	template<class InputIterator>
+	incremental_vector(InputIterator first,
+					   typename IsInputIter<InputIterator>::type last,
+					   const allocator_type &_alloc = allocator_type())
+			: arr(NULL), len(0), cap(0), old(NULL), oldcap(0), oldlen(0),
+			  moved(0), alloc(_alloc) { assign(first, last); }
+
+	incremental_vector(const incremental_vector &inst)
+			: arr(NULL), len(0), cap(0), old(NULL), oldcap(0), oldlen(0),
+			  moved(0), alloc(inst.alloc) { *this = inst; }
+
+	~incremental_vector(void) { clear(); }
+
+	incremental_vector &operator=(const incremental_vector &inst);
+
+#if __cplusplus >= 201103L
+	incremental_vector(incremental_vector &&inst) noexcept
+			: arr(NULL), len(0), cap(0), old(NULL), oldcap(0), oldlen(0),
+			  moved(0), alloc(inst.alloc) { swap(inst); }
+
+	incremental_vector &operator=(incremental_vector &&inst) noexcept {
+		if (this != &inst) {
+			clear();
+			swap(inst);
+		}
+		return (*this);
+	}
+#endif
+
+	//Iterators:
+	iterator begin(void) { return iterator(this, 0); }
+
+	const_iterator begin(void) const { return const_iterator(this, 0); }
+
+	iterator end(void) { return iterator(this, len); }
+
+	const_iterator end(void) const { return const_iterator(this, len); }
+
+	reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin(void) const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend(void) { return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend(void) const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin(void) const { return begin(); }
+
+	const_iterator cend(void) const { return end(); }
+
+	const_reverse_iterator crbegin(void) const { return rbegin(); }
+
+	const_reverse_iterator crend(void) const { return rend(); }
+
+	//Element access:
+	reference operator[](const size_type i) { return *slot(i); }
+
+	const_reference operator[](const size_type i) const { return *slot(i); }
+
+	reference at(const size_type n);
+
+	const_reference at(const size_type n) const;
+
+	reference front(void) { return *slot(0); }
+
+	const_reference front(void) const { return *slot(0); }
+
+	reference back(void) { return *slot(len - 1); }
+
+	const_reference back(void) const { return *slot(len - 1); }
+
+	//Capacity:
+	size_type size(void) const { return len; }
+
+	size_type max_size(void) const { return alloc.max_size(); }
+
+	void resize(const size_type n, const value_type &val = value_type());
+
+	size_type capacity(void) const { return cap; }
+
+	bool empty(void) const { return len == 0; }
+
+	//Starts a migration to a buffer of n elements, does not copy yet.
+	void reserve(const size_type n) {
+		if (n > cap)
+			grow(n);
+	}
+
+	bool migrating(void) const { return old != NULL; }
+
+	//Moves whatever is left in the old buffer now, e.g. while idle.
+	void finish_migration(void) { migrate(oldlen - moved); }
+
+	//Modifiers:
+	template<typename InputIterator>
+	typename IsInputIter<InputIterator, ft::setVoid>::type
+	assign(InputIterator first, InputIterator last);
+
+	void assign(const size_type n, const value_type &val);
+
+	void push_back(const value_type &value);
+
+	void pop_back(void);
+
+#if __cplusplus >= 201103L
+	void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+	template<typename... Args>
+	void emplace_back(Args &&... args);
+#endif
+
+	allocator_type get_allocator(void) const { return alloc; }
+
+	void swap(incremental_vector &x);
+
+	void clear(void);
+
+};
+
+//Compaire operators:
+template<typename T, typename Allocator>
+bool operator==(const incremental_vector<T, Allocator> &f,
+				const incremental_vector<T, Allocator> &s) {
+	return equal(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T, typename Allocator>
+bool operator!=(const incremental_vector<T, Allocator> &f,
+				const incremental_vector<T, Allocator> &s) {
+	return !(f == s);
+}
+
+template<typename T, typename Allocator>
+bool operator<(const incremental_vector<T, Allocator> &f,
+			   const incremental_vector<T, Allocator> &s) {
+	return ft::lexicographical_compare(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T, typename Allocator>
+bool operator<=(const incremental_vector<T, Allocator> &f,
+				const incremental_vector<T, Allocator> &s) {
+	return (f < s) || (f == s);
+}
+
+template<typename T, typename Allocator>
+bool operator>(const incremental_vector<T, Allocator> &f,
+			   const incremental_vector<T, Allocator> &s) {
+	return !(f < s) && (f != s);
+}
+
+template<typename T, typename Allocator>
+bool operator>=(const incremental_vector<T, Allocator> &f,
+				const incremental_vector<T, Allocator> &s) {
+	return (f > s) || (f == s);
+}
+
+//std::swap:
+template<typename T, typename Allocator>
+void swap(incremental_vector<T, Allocator> &f,
+		  incremental_vector<T, Allocator> &s) { f.swap(s); }
+
+template<typename T, typename Allocator>
+ft::incremental_vector<T, Allocator> &
+ft::incremental_vector<T, Allocator>::operator=(
+		const incremental_vector &inst) {
+	if (this == &inst)
+		return (*this);
+	destroy();
+	if (cap < inst.len)
+		grow(inst.len);
+	for (; len < inst.len; len++)
+		alloc.construct(&arr[len], inst[len]);
+	return (*this);
+}
+
+//Utils:
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::grow(size_type newcap) {
+	finish_migration();
+	old = arr;
+	oldcap = cap;
+	oldlen = len;
+	moved = 0;
+	arr = alloc.allocate(newcap);
+	cap = newcap;
+	if (oldlen == 0)
+		release_old();
+}
+
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::migrate(size_type n) {
+	for (; n && moved < oldlen; n--) {
+#if __cplusplus >= 201103L
+		std::allocator_traits<allocator_type>::construct(
+				alloc, &arr[moved], std::move_if_noexcept(old[moved]));
+#else
+		alloc.construct(&arr[moved], old[moved]);
+#endif
+		alloc.destroy(&old[moved]);
+		moved++;
+	}
+	if (old && moved == oldlen)
+		release_old();
+}
+
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::release_old(void) {
+	if (old)
+		alloc.deallocate(old, oldcap);
+	old = NULL;
+	oldcap = 0;
+	oldlen = 0;
+	moved = 0;
+}
+
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::destroy(void) {
+	while (len)
+		pop_back();
+}
+
+//Element acsses:
+template<typename T, typename Allocator>
+typename ft::incremental_vector<T, Allocator>::reference
+ft::incremental_vector<T, Allocator>::at(const size_type n) {
+	if (n < len)
+		return *slot(n);
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+template<typename T, typename Allocator>
+typename ft::incremental_vector<T, Allocator>::const_reference
+ft::incremental_vector<T, Allocator>::at(const size_type n) const {
+	if (n < len)
+		return *slot(n);
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+//Capacity:
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::resize(const size_type n,
+												  const value_type &val) {
+	while (len > n)
+		pop_back();
+	if (len == n)
+		return;
+	//val may live in a buffer that grow() or migrate() moves.
+	value_type tmp(val);
+	while (len < n)
+		push_back(tmp);
+}
+
+//Modifiers:
+template<typename T, typename Allocator>
+template<typename InputIterator>
+typename ft::IsInputIter<InputIterator, ft::setVoid>::type
+ft::incremental_vector<T, Allocator>::assign(InputIterator first,
+											 InputIterator last) {
+	destroy();
+	while (first != last)
+		push_back(*first++);
+}
+
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::assign(const size_type n,
+												  const value_type &val) {
+	destroy();
+	resize(n, val);
+}
+
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::push_back(const value_type &value) {
+	if (len == cap) {
+		//value may point into the old buffer, which grow() empties.
+		value_type tmp(value);
+		grow(cap ? cap * 2 : 2);
+		alloc.construct(&arr[len], tmp);
+	} else {
+		alloc.construct(&arr[len], value);
+	}
+	len++;
+	migrate(migrate_step);
+}
+
+#if __cplusplus >= 201103L
+template<typename T, typename Allocator>
+template<typename... Args>
+void ft::incremental_vector<T, Allocator>::emplace_back(Args &&... args) {
+	if (len == cap) {
+		value_type tmp(std::forward<Args>(args)...);
+		grow(cap ? cap * 2 : 2);
+		std::allocator_traits<allocator_type>::construct(
+				alloc, &arr[len], std::move(tmp));
+	} else {
+		std::allocator_traits<allocator_type>::construct(
+				alloc, &arr[len], std::forward<Args>(args)...);
+	}
+	len++;
+	migrate(migrate_step);
+}
+#endif
+
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::pop_back(void) {
+	if (len == 0)
+		return;
+	alloc.destroy(slot(--len));
+	//The old buffer's tail is gone, it has one element less to hand over.
+	if (len < oldlen && --oldlen == moved)
+		release_old();
+}
+
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::swap(incremental_vector &x) {
+	if (this == &x)
+		return;
+
+	value_type *xarr = x.arr;
+	size_type xlen = x.len;
+	size_type xcap = x.cap;
+	value_type *xold = x.old;
+	size_type xoldcap = x.oldcap;
+	size_type xoldlen = x.oldlen;
+	size_type xmoved = x.moved;
+
+	x.arr = arr;
+	x.len = len;
+	x.cap = cap;
+	x.old = old;
+	x.oldcap = oldcap;
+	x.oldlen = oldlen;
+	x.moved = moved;
+
+	arr = xarr;
+	len = xlen;
+	cap = xcap;
+	old = xold;
+	oldcap = xoldcap;
+	oldlen = xoldlen;
+	moved = xmoved;
+}
+
+template<typename T, typename Allocator>
+void ft::incremental_vector<T, Allocator>::clear(void) {
+	destroy();
+	release_old();
+	if (arr)
+		alloc.deallocate(arr, cap);
+	arr = NULL;
+	cap = 0;
+}
+
+template<typename T, typename Allocator>
+template<bool IsConst>
+struct ft::incremental_vector<T, Allocator>::common_iterator
+		: public iterator_base<std::random_access_iterator_tag,
+				typename conditional<IsConst, value_type, const value_type>::type> {
+	typedef
+	typename common_iterator::iterator_base::difference_type diff_t;
+
+	typedef
+	typename conditional_t<IsConst, value_type, const value_type>::type value_t;
+
+	typedef
+	typename conditional_t<IsConst, iterator, const_iterator>::type iter_t;
+
+private:
+	incremental_vector *vec;
+	size_type pos;
+
+public:
+	common_iterator(void) : vec(NULL), pos(0) {}
+
+	common_iterator(const incremental_vector *_vec, size_type _pos)
+			: vec(const_cast<incremental_vector *>(_vec)), pos(_pos) {}
+
+	common_iterator(const iterator &inst)
+			: vec(inst.vecBase()), pos(inst.base()) {}
+
+	~common_iterator(void) {}
+
+	iter_t &operator=(const iterator &inst) {
+		vec = inst.vecBase();
+		pos = inst.base();
+		return *this;
+	}
+
+	iter_t operator+(diff_t n) const { return iter_t(vec, pos + n); }
+
+	iter_t operator-(diff_t n) const { return iter_t(vec, pos - n); }
+
+	template<bool C>
+	diff_t operator-(const common_iterator<C> &rhs) const {
+		return static_cast<diff_t>(pos) - static_cast<diff_t>(rhs.base());
+	}
+
+	iter_t &operator+=(diff_t n) {
+		pos += n;
+		return *this;
+	}
+
+	iter_t &operator-=(diff_t n) {
+		pos -= n;
+		return *this;
+	}
+
+	iter_t &operator++(void) {
+		++pos;
+		return *this;
+	}
+
+	iter_t operator++(int) { return iter_t(vec, pos++); }
+
+	iter_t &operator--(void) {
+		--pos;
+		return *this;
+	}
+
+	iter_t operator--(int) { return iter_t(vec, pos--); }
+
+	value_t &operator*(void) const { return (*vec)[pos]; }
+
+	value_t *operator->(void) const { return &**this; }
+
+	value_t &operator[](diff_t n) const { return *(*this + n); }
+
+	//Index in the vector, used by the common comparison operators.
+	size_type base(void) const { return pos; }
+
+	incremental_vector *vecBase(void) const { return vec; }
+
+	void swap(iter_t &rhs) {
+		iter_t tmp = *this;
+		*this = rhs;
+		rhs = tmp;
+	}
+};
+}
+
+#endif //FT_CONTAINERS_FINAL_INCREMENTAL_VECTOR_HPP
@@ -9,6 +9,7 @@
 #include <iterator>
 
 #include "utils.hpp"
+#include "simd_compare.hpp"
 
 namespace ft{
 //Common:
@@ -119,14 +120,14 @@ public:
 	iter_t  &operator--(void){++iter; return *this;}
 	iter_t  operator--(int){return iter_t(iter++);}
 
-	value_t &operator*(void) const {iter_t res = iter; return *(--res.iter);}
-	value_t *operator->(void) const
+	reference   operator*(void) const {iter_t res = iter; return *(--res.iter);}
+	pointer     operator->(void) const
 	{
 		iter_t res = iter;
 		return &(*(--res.iter));
 	}
 
-	value_t &operator[](diff_t n) const
+	reference   operator[](diff_t n) const
 	{
 		iter_t res = iter;
 		return (--res.iter)[-n];
@@ -342,14 +343,108 @@ bool equal_impl(InputIterator1 first1, InputIterator1 last1,
 	return (first1 == last1) && (first2 == last2);
 }
 
+//Contiguous fast paths:
+//ft::is_contiguous_iterator: the elements sit at consecutive addresses.
+//Raw pointers are, iterators opt in with a contiguous_pointer typedef and
+//a base() that returns it.
+template<typename Iterator>
+struct is_contiguous_iterator
+{
+private:
+	template<typename U>
+	static char test(typename U::contiguous_pointer *);
+
+	template<typename U>
+	static long test(...);
+
+public:
+	static const bool value = sizeof(test<Iterator>(0)) == 1;
+};
+
+template<typename T>
+struct is_contiguous_iterator<T*> {static const bool value = true;};
+
+template<typename T>
+T   *to_pointer(T *p) { return p; }
+
+template<typename Iterator>
+typename Iterator::contiguous_pointer   to_pointer(const Iterator &it)
+{ return it.base(); }
+
+//ft::simd_comparable: both ranges are arrays of the same integral or
+//floating point type, so ft::simd can compare them.
+template<typename Iterator1, typename Iterator2>
+struct simd_comparable
+{
+	typedef typename remove_const<
+			typename iterator_traits<Iterator1>::value_type>::type value_type;
+
+	static const bool value = is_contiguous_iterator<Iterator1>::value
+			&& is_contiguous_iterator<Iterator2>::value
+			&& is_same<value_type, typename remove_const<
+					typename iterator_traits<Iterator2>::value_type>::type>::value
+			&& (is_integral<value_type>::value
+				|| is_same<value_type, float>::value
+				|| is_same<value_type, double>::value);
+};
+
+template<bool Simd>
+struct compare_dispatch
+{
+	template <typename InputIterator1, typename InputIterator2>
+	static bool equal(InputIterator1 first1, InputIterator1 last1,
+					  InputIterator2 first2, InputIterator2 last2)
+	{
+		return equal_impl(first1, last1, first2, last2,
+						  iterator_category(first1), iterator_category(first2));
+	}
+
+	template <typename InputIterator1, typename InputIterator2>
+	static bool less(InputIterator1 first1, InputIterator1 last1,
+					 InputIterator2 first2, InputIterator2 last2)
+	{
+		return lexicographical_compare_impl(first1, last1, first2, last2,
+											iterator_category(first1), iterator_category(first2));
+	}
+};
+
+template<>
+struct compare_dispatch<true>
+{
+	template <typename Iterator1, typename Iterator2>
+	static bool equal(Iterator1 first1, Iterator1 last1,
+					  Iterator2 first2, Iterator2 last2)
+	{
+		typedef typename simd_comparable<Iterator1, Iterator2>::value_type T;
+		size_t n = last1 - first1;
+
+		if (n != size_t(last2 - first2))
+			return false;
+		return simd::equal(static_cast<const T *>(to_pointer(first1)),
+						   static_cast<const T *>(to_pointer(first2)), n);
+	}
+
+	template <typename Iterator1, typename Iterator2>
+	static bool less(Iterator1 first1, Iterator1 last1,
+					 Iterator2 first2, Iterator2 last2)
+	{
+		typedef typename simd_comparable<Iterator1, Iterator2>::value_type T;
+
+		return simd::less(static_cast<const T *>(to_pointer(first1)),
+						  size_t(last1 - first1),
+						  static_cast<const T *>(to_pointer(first2)),
+						  size_t(last2 - first2));
+	}
+};
+
 
 template <typename InputIterator1, typename InputIterator2>
 bool lexicographical_compare(
 		InputIterator1 first1, InputIterator1 last1,
 		InputIterator2 first2, InputIterator2 last2)
 {
-	return lexicographical_compare_impl(first1, last1, first2, last2,
-										iterator_category(first1), iterator_category(first2));
+	return compare_dispatch<simd_comparable<InputIterator1, InputIterator2>::value>
+			::less(first1, last1, first2, last2);
 }
 
 template <typename InputIterator1, typename InputIterator2, typename Comp>
@@ -365,8 +460,8 @@ template <typename InputIterator1, typename InputIterator2>
 bool equal(InputIterator1 first1, InputIterator1 last1,
 		   InputIterator2 first2, InputIterator2 last2)
 {
-	return equal_impl(first1, last1, first2, last2,
-					  iterator_category(first1), iterator_category(first2));
+	return compare_dispatch<simd_comparable<InputIterator1, InputIterator2>::value>
+			::equal(first1, last1, first2, last2);
 }
 
 template <typename InputIterator1, typename InputIterator2, typename Comp>
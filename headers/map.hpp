@@ -71,6 +71,23 @@ public:
 		return *this;
 	}
 
+#if __cplusplus >= 201103L
+	map(map &&inst) noexcept
+			: comp(std::move(inst.comp)), alloc(std::move(inst.alloc))
+	{
+		rbt.swap(inst.rbt);
+	}
+
+	map &operator=(map &&inst) noexcept
+	{
+		if (this == &inst)
+			return *this;
+		rbt.clear();
+		rbt.swap(inst.rbt);
+		return *this;
+	}
+#endif
+
 	//Iterators:
 	iterator                begin(void){return rbt.begin();}
 	const_iterator          begin(void) const {return rbt.begin();}
@@ -96,6 +113,13 @@ public:
 		return rbt.insert(value_type(key, mapped_type())).first->second;
 	}
 
+#if __cplusplus >= 201103L
+	mapped_type    &operator[](key_type &&key)
+	{
+		return try_emplace(std::move(key)).first->second;
+	}
+#endif
+
 	//Modifiers:
 	pair<iterator, bool>    insert(const value_type &val)
 	{
@@ -117,6 +141,39 @@ public:
 		}
 	}
 
+#if __cplusplus >= 201103L
+	pair<iterator, bool>    insert(value_type &&val)
+	{
+		return rbt.insert(std::move(val));
+	}
+
+	iterator                insert(iterator position, value_type &&val)
+	{
+		return rbt.insert(std::move(val), position.base()).first;
+	}
+
+	template <typename... Args>
+	pair<iterator, bool>    emplace(Args &&... args)
+	{
+		return rbt.insert(value_type(std::forward<Args>(args)...));
+	}
+
+	//Unlike emplace, args are left untouched when key is already there.
+	template <typename... Args>
+	pair<iterator, bool>    try_emplace(const key_type &key, Args &&... args)
+	{
+		return rbt.emplace(key, NULL, key_construct, key,
+						   std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	pair<iterator, bool>    try_emplace(key_type &&key, Args &&... args)
+	{
+		return rbt.emplace(key, NULL, key_construct, std::move(key),
+						   std::forward<Args>(args)...);
+	}
+#endif
+
 	void        erase(iterator position){rbt.remove(position->first);}
 	size_type   erase(const key_type &key){return rbt.remove(key);}
 	void        erase(iterator first, iterator last)
@@ -0,0 +1,400 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_MAPPED_VECTOR_HPP
+#define FT_CONTAINERS_FINAL_MAPPED_VECTOR_HPP
+
+#include <cstddef>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+namespace ft {
+//ft::mapped_vector: an array of POD records that lives in a file and is
+//mapped with mmap(2) instead of being read in, so opening takes the same
+//time for any file size and pages are only faulted in when touched.
+//Iterators are the ft::vector<T> ones.
+//In read_write mode the file is kept at capacity() records while it is
+//open and trimmed to size() records by close().
+template<typename T>
+class mapped_vector {
+public:
+	typedef T value_type;
+	typedef T &reference;
+	typedef const T &const_reference;
+	typedef T *pointer;
+	typedef const T *const_pointer;
+	typedef size_t size_type;
+
+	typedef typename vector<T>::iterator iterator;
+	typedef typename vector<T>::const_iterator const_iterator;
+	typedef common_reverse_iterator<iterator> reverse_iterator;
+	typedef common_reverse_iterator<const_iterator> const_reverse_iterator;
+
+	enum mode_type {
+		//PROT_READ, writing through the mapping faults.
+		read_only,
+		//Writable, changes stay private to the process.
+		copy_on_write,
+		//Writable and growable, changes go to the file.
+		read_write
+	};
+
+	//madvise(2) hints for the whole mapping. dontneed is not only a hint:
+	//it drops the pages, so it is refused on a copy_on_write mapping,
+	//where it would throw away the private changes.
+	enum advice_type {
+		normal = MADV_NORMAL,
+		sequential = MADV_SEQUENTIAL,
+		random = MADV_RANDOM,
+		willneed = MADV_WILLNEED,
+		dontneed = MADV_DONTNEED
+	};
+
+
+private:
+	value_type *arr;
+	size_type len;
+	size_type cap;
+	int fd;
+	mode_type mode;
+
+private:
+	//Utils:
+	static void fail(const char *what, const char *path = NULL);
+
+	void map(size_type newcap);
+
+	//read_write only: grows the file and the mapping to newcap records.
+	void uptocap(size_type newcap);
+
+	mapped_vector(const mapped_vector &);
+
+	mapped_vector &operator=(const mapped_vector &);
+
+public:
+	mapped_vector(void)
+			: arr(NULL), len(0), cap(0), fd(-1), mode(read_only) {}
+
+	explicit mapped_vector(const char *path, mode_type _mode = read_only)
+			: arr(NULL), len(0), cap(0), fd(-1), mode(read_only) {
+		open(path, _mode);
+	}
+
+	~mapped_vector(void) { close(); }
+
+	void open(const char *path, mode_type _mode = read_only);
+
+	void close(void);
+
+	bool is_open(void) const { return fd != -1; }
+
+	mode_type get_mode(void) const { return mode; }
+
+	//Iterators:
+	iterator begin(void) { return iterator(arr); }
+
+	const_iterator begin(void) const { return const_iterator(arr); }
+
+	iterator end(void) { return iterator(arr + len); }
+
+	const_iterator end(void) const { return const_iterator(arr + len); }
+
+	reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin(void) const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend(void) { return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend(void) const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin(void) const { return begin(); }
+
+	const_iterator cend(void) const { return end(); }
+
+	const_reverse_iterator crbegin(void) const { return rbegin(); }
+
+	const_reverse_iterator crend(void) const { return rend(); }
+
+	//Element access:
+	reference operator[](const size_type i) { return arr[i]; }
+
+	const_reference operator[](const size_type i) const { return arr[i]; }
+
+	reference at(const size_type n);
+
+	const_reference at(const size_type n) const;
+
+	reference front(void) { return *arr; }
+
+	const_reference front(void) const { return *arr; }
+
+	reference back(void) { return arr[len - 1]; }
+
+	const_reference back(void) const { return arr[len - 1]; }
+
+	value_type *data(void) { return arr; }
+
+	const value_type *data(void) const { return arr; }
+
+	//Capacity:
+	size_type size(void) const { return len; }
+
+	size_type max_size(void) const { return size_type(-1) / sizeof(T); }
+
+	size_type capacity(void) const { return cap; }
+
+	bool empty(void) const { return len == 0; }
+
+	void reserve(const size_type n) {
+		if (n > cap)
+			uptocap(n);
+	}
+
+	void resize(const size_type n, const value_type &val = value_type());
+
+	//Returns false when the kernel rejected the hint, or for dontneed in
+	//copy_on_write mode.
+	bool advise(advice_type advice);
+
+	//Modifiers:
+	void push_back(const value_type &val) {
+		if (len == cap)
+			uptocap(cap * 2);
+		arr[len++] = val;
+	}
+
+	void pop_back(void) { if (len) len--; }
+
+	//read_write only: flushes the records to the file.
+	void sync(void);
+
+	void swap(mapped_vector &x);
+
+};
+
+//Compaire operators:
+template<typename T>
+bool operator==(const mapped_vector<T> &f, const mapped_vector<T> &s) {
+	return equal(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T>
+bool operator!=(const mapped_vector<T> &f, const mapped_vector<T> &s) {
+	return !(f == s);
+}
+
+template<typename T>
+bool operator<(const mapped_vector<T> &f, const mapped_vector<T> &s) {
+	return ft::lexicographical_compare(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T>
+bool operator<=(const mapped_vector<T> &f, const mapped_vector<T> &s) {
+	return (f < s) || (f == s);
+}
+
+template<typename T>
+bool operator>(const mapped_vector<T> &f, const mapped_vector<T> &s) {
+	return !(f < s) && (f != s);
+}
+
+template<typename T>
+bool operator>=(const mapped_vector<T> &f, const mapped_vector<T> &s) {
+	return (f > s) || (f == s);
+}
+
+//std::swap:
+template<typename T>
+void swap(mapped_vector<T> &f, mapped_vector<T> &s) { f.swap(s); }
+
+//Utils:
+template<typename T>
+void ft::mapped_vector<T>::fail(const char *what, const char *path) {
+	char err[512];
+
+	if (path)
+		snprintf(err, 512, "mapped_vector::%s: %s: %s", what, path,
+				 std::strerror(errno));
+	else
+		snprintf(err, 512, "mapped_vector::%s: %s", what, std::strerror(errno));
+	throw std::runtime_error(err);
+}
+
+template<typename T>
+void ft::mapped_vector<T>::map(size_type newcap) {
+	int prot = PROT_READ;
+	int flags = MAP_SHARED;
+	void *p;
+
+	if (mode != read_only)
+		prot |= PROT_WRITE;
+	if (mode == copy_on_write)
+		flags = MAP_PRIVATE;
+	p = mmap(NULL, newcap * sizeof(T), prot, flags, fd, 0);
+	if (p == MAP_FAILED)
+		fail("mmap");
+	arr = static_cast<value_type *>(p);
+	cap = newcap;
+}
+
+template<typename T>
+void ft::mapped_vector<T>::uptocap(size_type newcap) {
+	void *p;
+
+	if (mode != read_write)
+		throw std::logic_error(
+				"mapped_vector: only read_write mappings can grow");
+	if (newcap < 4096 / sizeof(T))
+		newcap = 4096 / sizeof(T) ? 4096 / sizeof(T) : 1;
+	if (ftruncate(fd, newcap * sizeof(T)) != 0)
+		fail("ftruncate");
+	if (arr == NULL)
+		return map(newcap);
+#ifdef __linux__
+	p = mremap(arr, cap * sizeof(T), newcap * sizeof(T), MREMAP_MAYMOVE);
+	if (p == MAP_FAILED)
+		fail("mremap");
+	arr = static_cast<value_type *>(p);
+	cap = newcap;
+#else
+	(void)p;
+	munmap(arr, cap * sizeof(T));
+	arr = NULL;
+	map(newcap);
+#endif
+}
+
+template<typename T>
+void ft::mapped_vector<T>::open(const char *path, mode_type _mode) {
+	struct stat st;
+
+	close();
+	fd = ::open(path, _mode == read_write ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+	if (fd < 0)
+		fail("open", path);
+	if (fstat(fd, &st) != 0) {
+		int err = errno;
+		close();
+		errno = err;
+		fail("fstat", path);
+	}
+	mode = _mode;
+	len = st.st_size / sizeof(T);
+	if (len == 0)
+		return;
+	try {
+		map(len);
+	}
+	catch (...) {
+		close();
+		throw;
+	}
+}
+
+//Also runs from the destructor, so trimming the file is best effort.
+template<typename T>
+void ft::mapped_vector<T>::close(void) {
+	int ret;
+
+	if (arr)
+		munmap(arr, cap * sizeof(T));
+	if (fd >= 0 && mode == read_write && cap != len) {
+		ret = ftruncate(fd, len * sizeof(T));
+		(void)ret;
+	}
+	if (fd >= 0)
+		::close(fd);
+	arr = NULL;
+	len = 0;
+	cap = 0;
+	fd = -1;
+}
+
+//Element acsses:
+template<typename T>
+typename ft::mapped_vector<T>::reference
+ft::mapped_vector<T>::at(const size_type n) {
+	if (n < len)
+		return arr[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+template<typename T>
+typename ft::mapped_vector<T>::const_reference
+ft::mapped_vector<T>::at(const size_type n) const {
+	if (n < len)
+		return arr[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+//Capacity:
+template<typename T>
+void ft::mapped_vector<T>::resize(const size_type n, const value_type &val) {
+	if (n > cap)
+		uptocap(n > cap * 2 ? n : cap * 2);
+	for (; len < n; len++)
+		arr[len] = val;
+	len = n;
+}
+
+template<typename T>
+bool ft::mapped_vector<T>::advise(advice_type advice) {
+	if (advice == dontneed && mode == copy_on_write)
+		return false;
+	if (arr == NULL)
+		return true;
+	return madvise(arr, cap * sizeof(T), advice) == 0;
+}
+
+//Modifiers:
+template<typename T>
+void ft::mapped_vector<T>::sync(void) {
+	if (arr && mode == read_write && msync(arr, len * sizeof(T), MS_SYNC) != 0)
+		fail("msync");
+}
+
+template<typename T>
+void ft::mapped_vector<T>::swap(mapped_vector<T> &x) {
+	if (this == &x)
+		return;
+
+	value_type *xarr = x.arr;
+	size_type xlen = x.len;
+	size_type xcap = x.cap;
+	int xfd = x.fd;
+	mode_type xmode = x.mode;
+
+	x.arr = arr;
+	x.len = len;
+	x.cap = cap;
+	x.fd = fd;
+	x.mode = mode;
+
+	arr = xarr;
+	len = xlen;
+	cap = xcap;
+	fd = xfd;
+	mode = xmode;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_MAPPED_VECTOR_HPP
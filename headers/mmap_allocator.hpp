@@ -0,0 +1,210 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_MMAP_ALLOCATOR_HPP
+#define FT_CONTAINERS_FINAL_MMAP_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+#include "utils.hpp"
+
+namespace ft {
+//Options for ft::mmap_allocator, may be or-ed together.
+enum mmap_options {
+	mmap_default = 0,
+	//madvise(MADV_HUGEPAGE): ask for transparent huge pages, fewer TLB misses
+	//on random access to big blocks.
+	mmap_huge_pages = 1,
+	//Fault every page in when it is allocated instead of on first touch.
+	mmap_populate = 2,
+	//mlock(2) the pages. Best effort: skipped when RLIMIT_MEMLOCK is too low.
+	mmap_lock = 4
+};
+
+//ft::mmap_allocator: blocks of at least mmap_threshold bytes are anonymous
+//mappings, smaller ones come from operator new.
+//reallocate() grows a mapping with mremap(2) on Linux, so the pages are
+//moved by the kernel instead of being copied. ft::vector uses it for
+//trivially copyable elements.
+template<typename T>
+class mmap_allocator {
+public:
+	typedef T value_type;
+	typedef T *pointer;
+	typedef const T *const_pointer;
+	typedef T &reference;
+	typedef const T &const_reference;
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+
+	template<typename U>
+	struct rebind {
+		typedef mmap_allocator<U> other;
+	};
+
+	//Same default as glibc's M_MMAP_THRESHOLD.
+	static const size_type mmap_threshold = 128 * 1024;
+
+private:
+	int opts;
+
+	//Utils:
+	static size_type page_round(size_type bytes) {
+		static const size_type page = sysconf(_SC_PAGESIZE);
+
+		return (bytes + page - 1) & ~(page - 1);
+	}
+
+	//Applies the options to the fresh bytes [from, to) of a mapping.
+	void prepare(char *p, size_type from, size_type to) const;
+
+public:
+	mmap_allocator(int _opts = mmap_default): opts(_opts) {}
+
+	mmap_allocator(const mmap_allocator &inst): opts(inst.opts) {}
+
+	template<typename U>
+	mmap_allocator(const mmap_allocator<U> &inst)
+			: opts(inst.options()) {}
+
+	~mmap_allocator(void) {}
+
+	int options(void) const { return opts; }
+
+	pointer address(reference x) const { return &x; }
+
+	const_pointer address(const_reference x) const { return &x; }
+
+	size_type max_size(void) const {
+		return (size_type(-1) >> 1) / sizeof(T);
+	}
+
+	pointer allocate(size_type n, const void * = 0);
+
+	void deallocate(pointer p, size_type n);
+
+	//Moves the n first elements of p into a block of newn elements and
+	//returns it. T has to be trivially copyable.
+	pointer reallocate(pointer p, size_type n, size_type newn);
+
+#if __cplusplus >= 201103L
+	template<typename U, typename... Args>
+	void construct(U *p, Args &&... args) {
+		::new(static_cast<void *>(p)) U(std::forward<Args>(args)...);
+	}
+
+	template<typename U>
+	void destroy(U *p) { p->~U(); }
+#else
+	void construct(pointer p, const_reference val) {
+		::new(static_cast<void *>(p)) value_type(val);
+	}
+
+	void destroy(pointer p) { p->~value_type(); }
+#endif
+};
+
+template<typename T>
+struct has_reallocate<mmap_allocator<T> > {static const bool value = true;};
+
+//Any instance can free what another one allocated.
+template<typename T, typename U>
+bool operator==(const mmap_allocator<T> &, const mmap_allocator<U> &) {
+	return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const mmap_allocator<T> &, const mmap_allocator<U> &) {
+	return false;
+}
+
+//Utils:
+template<typename T>
+void ft::mmap_allocator<T>::prepare(char *p, size_type from,
+									size_type to) const {
+	static const size_type page = sysconf(_SC_PAGESIZE);
+
+	if (from >= to)
+		return;
+#ifdef MADV_HUGEPAGE
+	//Before the pages are touched, so populating already gets huge ones.
+	if (opts & mmap_huge_pages)
+		madvise(p + from, to - from, MADV_HUGEPAGE);
+#endif
+	if ((opts & mmap_lock) && mlock(p + from, to - from) == 0)
+		return;
+	if (opts & mmap_populate)
+		for (volatile char *it = p + from; it < p + to; it += page)
+			*it = 0;
+}
+
+template<typename T>
+typename ft::mmap_allocator<T>::pointer
+ft::mmap_allocator<T>::allocate(size_type n, const void *) {
+	size_type bytes;
+	void *p;
+
+	if (n > max_size())
+		throw std::bad_alloc();
+	bytes = n * sizeof(T);
+	if (bytes < mmap_threshold)
+		return static_cast<pointer>(::operator new(bytes));
+	bytes = page_round(bytes);
+	p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+			 -1, 0);
+	if (p == MAP_FAILED)
+		throw std::bad_alloc();
+	prepare(static_cast<char *>(p), 0, bytes);
+	return static_cast<pointer>(p);
+}
+
+template<typename T>
+void ft::mmap_allocator<T>::deallocate(pointer p, size_type n) {
+	if (p == NULL)
+		return;
+	if (n * sizeof(T) < mmap_threshold)
+		::operator delete(p);
+	else
+		munmap(p, page_round(n * sizeof(T)));
+}
+
+template<typename T>
+typename ft::mmap_allocator<T>::pointer
+ft::mmap_allocator<T>::reallocate(pointer p, size_type n, size_type newn) {
+	pointer tmp;
+
+	if (p == NULL)
+		return allocate(newn);
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+	size_type bytes = n * sizeof(T);
+	size_type newbytes = newn * sizeof(T);
+
+	if (newn > max_size())
+		throw std::bad_alloc();
+	if (bytes >= mmap_threshold && newbytes >= mmap_threshold) {
+		void *q = mremap(p, page_round(bytes), page_round(newbytes),
+						 MREMAP_MAYMOVE);
+		if (q == MAP_FAILED)
+			throw std::bad_alloc();
+		prepare(static_cast<char *>(q), page_round(bytes),
+				page_round(newbytes));
+		return static_cast<pointer>(q);
+	}
+#endif
+	tmp = allocate(newn);
+	std::memcpy(static_cast<void *>(tmp), static_cast<const void *>(p),
+				(n < newn ? n : newn) * sizeof(T));
+	deallocate(p, n);
+	return tmp;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_MMAP_ALLOCATOR_HPP
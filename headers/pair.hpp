@@ -5,7 +5,21 @@
 #ifndef FT_CONTAINERS_FINAL_PAIR_HPP
 #define FT_CONTAINERS_FINAL_PAIR_HPP
 
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+#include "utils.hpp"
+
 namespace ft {
+#if __cplusplus >= 201103L
+//ft::key_construct: tag for building a pair from a key and the arguments
+//of its second member, see map::try_emplace.
+struct key_construct_t {};
+
+const key_construct_t key_construct = key_construct_t();
+#endif
+
 template<typename T1, typename T2>
 struct pair {
 	typedef T1 first_type;
@@ -20,6 +34,27 @@ struct pair {
 	pair(const pair<U, V> &pr): first(pr.first), second(pr.second) {}
 
 	pair(const first_type &a, const second_type &b): first(a), second(b) {}
+
+	pair(const pair &pr): first(pr.first), second(pr.second) {}
+
+#if __cplusplus >= 201103L
+	//Only for arguments that convert, so that pair(NULL, 1) still picks
+	//the const first_type & overload as in C++98.
+	template<typename U, typename V, typename = typename enable_if<
+			std::is_convertible<U, first_type>::value
+			&& std::is_convertible<V, second_type>::value>::type>
+	pair(U &&a, V &&b): first(std::forward<U>(a)), second(std::forward<V>(b)) {}
+
+	template<typename U, typename... Args>
+	pair(key_construct_t, U &&a, Args &&... args)
+		: first(std::forward<U>(a)), second(std::forward<Args>(args)...) {}
+
+	template<typename U,typename V>
+	pair(pair<U, V> &&pr)
+		: first(std::move(pr.first)), second(std::move(pr.second)) {}
+
+	pair(pair &&pr): first(std::move(pr.first)), second(std::move(pr.second)) {}
+#endif
 	~pair(){}
 
 	pair& operator=(const pair &pr) {
@@ -29,12 +64,29 @@ struct pair {
 		second = pr.second;
 		return *this;
 	}
+
+#if __cplusplus >= 201103L
+	pair& operator=(pair &&pr) {
+		if (this == &pr)
+			return *this;
+		first = std::move(pr.first);
+		second = std::move(pr.second);
+		return *this;
+	}
+#endif
 };
 
+#if __cplusplus >= 201103L
+template<typename T1, typename T2>
+ft::pair<T1, T2> make_pair(T1 f, T2 s){
+	return ft::pair<T1, T2>(std::move(f), std::move(s));
+}
+#else
 template<typename T1, typename T2>
 ft::pair<T1, T2> make_pair(const T1 f, const T2 s){
 	return ft::pair<T1, T2>(f, s);
 }
+#endif
 
 template <class T1, class T2>
 bool operator==(const ft::pair<T1, T2> &lhs, const ft::pair<T1, T2> &rhs){
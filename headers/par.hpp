@@ -0,0 +1,619 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_PAR_HPP
+#define FT_CONTAINERS_FINAL_PAR_HPP
+
+#include <cstddef>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+#include "deque.hpp"
+#include "algorithm.hpp"
+
+//ft::par: parallel for_each, transform, reduce, fill, copy and a stable
+//merge sort over random access ranges (ft::vector iterators, pointers).
+//They run on a shared pool of pthreads, link with -pthread.
+//The range is cut in a few chunks per thread, the calling thread works on
+//them too. Like the std::execution::par algorithms, the functors run
+//concurrently and must not throw.
+namespace ft {
+namespace par {
+class task_group;
+
+//One unit of work: fn(arg), counted in group.
+struct task {
+	void (*fn)(void *);
+	void *arg;
+	task_group *group;
+};
+
+//ft::par::thread_pool: one task deque per thread. A thread pops the newest
+//task of its own deque and, when it is empty, steals the oldest one of
+//another deque. Threads that are not part of the pool share deque 0.
+class thread_pool {
+	struct worker_queue {
+		pthread_mutex_t lock;
+		deque<task> tasks;
+	};
+
+	size_t nthreads;
+	worker_queue *queues;
+	pthread_t *threads;
+	pthread_mutex_t idle_lock;
+	pthread_cond_t idle_cond;
+	long queued;
+	bool stop;
+
+	//Utils:
+	//Deque of the calling thread, 0 outside of the pool.
+	static size_t &self(void) {
+		static __thread size_t index = 0;
+
+		return index;
+	}
+
+	static void *worker_main(void *arg);
+
+	bool pop(size_t q, bool newest, task &t);
+
+	thread_pool(const thread_pool &);
+
+	thread_pool &operator=(const thread_pool &);
+
+public:
+	//n threads, the calling one included: n - 1 are started.
+	explicit thread_pool(size_t n);
+
+	~thread_pool(void);
+
+	size_t size(void) const { return nthreads; }
+
+	void submit(const task &t);
+
+	//Runs one queued task, false when there was none.
+	bool run_one(void);
+
+	//The pool the algorithms use, one thread per online CPU by default.
+	static thread_pool &instance(void);
+
+	//Replaces the shared pool by one of n threads. Not while an algorithm
+	//runs.
+	static void resize(size_t n);
+
+private:
+	static thread_pool *&shared(void) {
+		static thread_pool *pool = NULL;
+
+		return pool;
+	}
+
+	static pthread_mutex_t &shared_lock(void) {
+		static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+		return lock;
+	}
+};
+
+//ft::par::task_group: tasks run() on a pool, wait() returns once all of
+//them are done. The waiting thread runs queued tasks meanwhile, so tasks
+//may start and wait for their own groups.
+class task_group {
+	thread_pool *pool;
+	long pending;
+
+	friend class thread_pool;
+
+	task_group(const task_group &);
+
+	task_group &operator=(const task_group &);
+
+public:
+	explicit task_group(thread_pool &_pool = thread_pool::instance())
+			: pool(&_pool), pending(0) {}
+
+	~task_group(void) { wait(); }
+
+	thread_pool &get_pool(void) const { return *pool; }
+
+	void run(void (*fn)(void *), void *arg) {
+		task t = {fn, arg, this};
+
+		__atomic_add_fetch(&pending, 1, __ATOMIC_RELAXED);
+		pool->submit(t);
+	}
+
+	void wait(void) {
+		while (__atomic_load_n(&pending, __ATOMIC_ACQUIRE) > 0)
+			if (!pool->run_one())
+				sched_yield();
+	}
+};
+
+inline size_t thread_count(void) { return thread_pool::instance().size(); }
+
+inline void set_thread_count(size_t n) { thread_pool::resize(n); }
+
+//Pool:
+inline ft::par::thread_pool::thread_pool(size_t n)
+		: nthreads(n ? n : 1), queues(NULL), threads(NULL), queued(0),
+		  stop(false) {
+	pthread_mutex_init(&idle_lock, NULL);
+	pthread_cond_init(&idle_cond, NULL);
+	queues = new worker_queue[nthreads];
+	for (size_t i = 0; i < nthreads; i++)
+		pthread_mutex_init(&queues[i].lock, NULL);
+	threads = new pthread_t[nthreads];
+	for (size_t i = 1; i < nthreads; i++) {
+		void **arg = new void *[2];
+		arg[0] = this;
+		arg[1] = reinterpret_cast<void *>(i);
+		if (pthread_create(&threads[i], NULL, &worker_main, arg) != 0) {
+			delete[] arg;
+			nthreads = i;
+			break;
+		}
+	}
+}
+
+inline ft::par::thread_pool::~thread_pool(void) {
+	pthread_mutex_lock(&idle_lock);
+	stop = true;
+	pthread_cond_broadcast(&idle_cond);
+	pthread_mutex_unlock(&idle_lock);
+	for (size_t i = 1; i < nthreads; i++)
+		pthread_join(threads[i], NULL);
+	for (size_t i = 0; i < nthreads; i++)
+		pthread_mutex_destroy(&queues[i].lock);
+	delete[] threads;
+	delete[] queues;
+	pthread_cond_destroy(&idle_cond);
+	pthread_mutex_destroy(&idle_lock);
+}
+
+inline void *ft::par::thread_pool::worker_main(void *arg) {
+	void **args = static_cast<void **>(arg);
+	thread_pool *pool = static_cast<thread_pool *>(args[0]);
+
+	self() = reinterpret_cast<size_t>(args[1]);
+	delete[] args;
+	for (;;) {
+		if (pool->run_one())
+			continue;
+		pthread_mutex_lock(&pool->idle_lock);
+		while (!pool->stop
+			   && __atomic_load_n(&pool->queued, __ATOMIC_ACQUIRE) == 0)
+			pthread_cond_wait(&pool->idle_cond, &pool->idle_lock);
+		pthread_mutex_unlock(&pool->idle_lock);
+		if (pool->stop)
+			return NULL;
+	}
+}
+
+inline bool ft::par::thread_pool::pop(size_t q, bool newest, task &t) {
+	bool found = false;
+
+	pthread_mutex_lock(&queues[q].lock);
+	if (!queues[q].tasks.empty()) {
+		if (newest) {
+			t = queues[q].tasks.back();
+			queues[q].tasks.pop_back();
+		} else {
+			t = queues[q].tasks.front();
+			queues[q].tasks.pop_front();
+		}
+		found = true;
+	}
+	pthread_mutex_unlock(&queues[q].lock);
+	return found;
+}
+
+inline void ft::par::thread_pool::submit(const task &t) {
+	size_t q = self() < nthreads ? self() : 0;
+
+	pthread_mutex_lock(&queues[q].lock);
+	queues[q].tasks.push_back(t);
+	pthread_mutex_unlock(&queues[q].lock);
+	__atomic_add_fetch(&queued, 1, __ATOMIC_RELEASE);
+	pthread_mutex_lock(&idle_lock);
+	pthread_cond_signal(&idle_cond);
+	pthread_mutex_unlock(&idle_lock);
+}
+
+inline bool ft::par::thread_pool::run_one(void) {
+	size_t me = self() < nthreads ? self() : 0;
+	task t;
+
+	if (__atomic_load_n(&queued, __ATOMIC_ACQUIRE) == 0)
+		return false;
+	bool found = pop(me, true, t);
+	for (size_t k = 1; !found && k < nthreads; k++)
+		found = pop((me + k) % nthreads, false, t);
+	if (!found)
+		return false;
+	__atomic_sub_fetch(&queued, 1, __ATOMIC_RELAXED);
+	t.fn(t.arg);
+	__atomic_sub_fetch(&t.group->pending, 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+inline ft::par::thread_pool &ft::par::thread_pool::instance(void) {
+	thread_pool *pool = __atomic_load_n(&shared(), __ATOMIC_ACQUIRE);
+	long cpus;
+
+	if (pool)
+		return *pool;
+	pthread_mutex_lock(&shared_lock());
+	if (!shared()) {
+		cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		__atomic_store_n(&shared(), new thread_pool(cpus > 0 ? cpus : 1),
+						 __ATOMIC_RELEASE);
+	}
+	pool = shared();
+	pthread_mutex_unlock(&shared_lock());
+	return *pool;
+}
+
+inline void ft::par::thread_pool::resize(size_t n) {
+	pthread_mutex_lock(&shared_lock());
+	delete shared();
+	__atomic_store_n(&shared(), new thread_pool(n), __ATOMIC_RELEASE);
+	pthread_mutex_unlock(&shared_lock());
+}
+
+//Chunks:
+//Cuts [0, n) in chunks of at least min_grain elements, about four per
+//thread, and calls body(chunk, begin, end) for each of them in parallel.
+template<typename Body>
+struct chunk_job {
+	Body *body;
+	size_t chunk;
+	size_t begin;
+	size_t end;
+
+	static void run(void *arg) {
+		chunk_job *job = static_cast<chunk_job *>(arg);
+
+		(*job->body)(job->chunk, job->begin, job->end);
+	}
+};
+
+const size_t min_grain = 4096;
+
+inline size_t chunk_count(size_t n) {
+	size_t chunks = thread_count() * 4;
+
+	if (n / min_grain < chunks)
+		chunks = n / min_grain;
+	return chunks ? chunks : 1;
+}
+
+template<typename Body>
+void for_chunks(size_t n, Body &body) {
+	size_t chunks = chunk_count(n);
+
+	if (chunks == 1) {
+		if (n)
+			body(0, 0, n);
+		return;
+	}
+	vector<chunk_job<Body> > jobs(chunks);
+	task_group group;
+	for (size_t c = 0; c < chunks; c++) {
+		jobs[c].body = &body;
+		jobs[c].chunk = c;
+		jobs[c].begin = n / chunks * c + (c < n % chunks ? c : n % chunks);
+		jobs[c].end = jobs[c].begin + n / chunks + (c < n % chunks);
+		if (c)
+			group.run(&chunk_job<Body>::run, &jobs[c]);
+	}
+	chunk_job<Body>::run(&jobs[0]);
+	group.wait();
+}
+
+//Algorithms:
+template<typename RandomIt, typename Function>
+struct for_each_body {
+	RandomIt first;
+	Function fn;
+
+	void operator()(size_t, size_t b, size_t e) {
+		Function f(fn);
+
+		for (RandomIt it = first + b; it != first + e; ++it)
+			f(*it);
+	}
+};
+
+template<typename RandomIt, typename Function>
+void for_each(RandomIt first, RandomIt last, Function fn) {
+	for_each_body<RandomIt, Function> body = {first, fn};
+
+	for_chunks(last - first, body);
+}
+
+template<typename RandomIt, typename OutputIt, typename Operation>
+struct transform_body {
+	RandomIt first;
+	OutputIt out;
+	Operation op;
+
+	void operator()(size_t, size_t b, size_t e) {
+		RandomIt it = first + b;
+		OutputIt o = out + b;
+
+		for (; it != first + e; ++it, ++o)
+			*o = op(*it);
+	}
+};
+
+template<typename RandomIt, typename OutputIt, typename Operation>
+OutputIt transform(RandomIt first, RandomIt last, OutputIt out,
+				   Operation op) {
+	transform_body<RandomIt, OutputIt, Operation> body = {first, out, op};
+
+	for_chunks(last - first, body);
+	return out + (last - first);
+}
+
+template<typename RandomIt1, typename RandomIt2, typename OutputIt,
+		typename Operation>
+struct transform2_body {
+	RandomIt1 first1;
+	RandomIt2 first2;
+	OutputIt out;
+	Operation op;
+
+	void operator()(size_t, size_t b, size_t e) {
+		for (size_t i = b; i < e; i++)
+			out[i] = op(first1[i], first2[i]);
+	}
+};
+
+template<typename RandomIt1, typename RandomIt2, typename OutputIt,
+		typename Operation>
+OutputIt transform(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2,
+				   OutputIt out, Operation op) {
+	transform2_body<RandomIt1, RandomIt2, OutputIt, Operation> body
+			= {first1, first2, out, op};
+
+	for_chunks(last1 - first1, body);
+	return out + (last1 - first1);
+}
+
+template<typename T>
+struct plus {
+	T operator()(const T &a, const T &b) const { return a + b; }
+};
+
+template<typename RandomIt, typename T, typename Operation>
+struct reduce_body {
+	RandomIt first;
+	Operation op;
+	vector<T> *partial;
+
+	void operator()(size_t c, size_t b, size_t e) {
+		T acc = first[b];
+
+		for (RandomIt it = first + b + 1; it != first + e; ++it)
+			acc = op(acc, *it);
+		(*partial)[c] = acc;
+	}
+};
+
+//op has to be associative: chunks are folded apart, then in order.
+template<typename RandomIt, typename T, typename Operation>
+T reduce(RandomIt first, RandomIt last, T init, Operation op) {
+	vector<T> partial(chunk_count(last - first), init);
+	reduce_body<RandomIt, T, Operation> body = {first, op, &partial};
+
+	if (first == last)
+		return init;
+	for_chunks(last - first, body);
+	for (size_t c = 0; c < partial.size(); c++)
+		init = op(init, partial[c]);
+	return init;
+}
+
+template<typename RandomIt, typename T>
+T reduce(RandomIt first, RandomIt last, T init) {
+	return par::reduce(first, last, init, plus<T>());
+}
+
+template<typename RandomIt, typename T>
+struct fill_body {
+	RandomIt first;
+	const T *val;
+
+	void operator()(size_t, size_t b, size_t e) {
+		for (RandomIt it = first + b; it != first + e; ++it)
+			*it = *val;
+	}
+};
+
+template<typename RandomIt, typename T>
+void fill(RandomIt first, RandomIt last, const T &val) {
+	fill_body<RandomIt, T> body = {first, &val};
+
+	for_chunks(last - first, body);
+}
+
+template<typename RandomIt, typename OutputIt>
+struct copy_body {
+	RandomIt first;
+	OutputIt out;
+
+	void operator()(size_t, size_t b, size_t e) {
+		RandomIt it = first + b;
+		OutputIt o = out + b;
+
+		for (; it != first + e; ++it, ++o)
+			*o = *it;
+	}
+};
+
+template<typename RandomIt, typename OutputIt>
+OutputIt copy(RandomIt first, RandomIt last, OutputIt out) {
+	copy_body<RandomIt, OutputIt> body = {first, out};
+
+	for_chunks(last - first, body);
+	return out + (last - first);
+}
+
+//Sort:
+//Splits the larger range at its middle and the other one at the same
+//value, both halves merge in parallel.
+template<typename It1, typename It2, typename OutputIt, typename Comp>
+struct merge_job {
+	It1 a;
+	size_t na;
+	It2 b;
+	size_t nb;
+	OutputIt out;
+	Comp *comp;
+	size_t grain;
+
+	static void run(void *arg) {
+		merge_job *job = static_cast<merge_job *>(arg);
+		size_t i;
+		size_t j;
+
+		if (job->na + job->nb <= job->grain) {
+			merge_into(job->a, job->na, job->b, job->nb, job->out,
+						 *job->comp);
+			return;
+		}
+		if (job->na >= job->nb) {
+			i = job->na / 2;
+			j = lower(job->b, job->nb, job->a[i], *job->comp);
+		} else {
+			j = job->nb / 2;
+			i = upper(job->a, job->na, job->b[j], *job->comp);
+		}
+		merge_job left = {job->a, i, job->b, j, job->out, job->comp,
+						  job->grain};
+		merge_job right = {job->a + i, job->na - i, job->b + j, job->nb - j,
+						   job->out + (i + j), job->comp, job->grain};
+		task_group group;
+		group.run(&run, &left);
+		run(&right);
+		group.wait();
+	}
+
+	//First element of b not less than val.
+	template<typename It, typename T>
+	static size_t lower(It b, size_t n, const T &val, Comp &comp) {
+		size_t lo = 0;
+
+		while (n > 0) {
+			if (comp(b[lo + n / 2], val)) {
+				lo += n / 2 + 1;
+				n -= n / 2 + 1;
+			} else
+				n /= 2;
+		}
+		return lo;
+	}
+
+	//First element of a greater than val.
+	template<typename It, typename T>
+	static size_t upper(It a, size_t n, const T &val, Comp &comp) {
+		size_t lo = 0;
+
+		while (n > 0) {
+			if (!comp(val, a[lo + n / 2])) {
+				lo += n / 2 + 1;
+				n -= n / 2 + 1;
+			} else
+				n /= 2;
+		}
+		return lo;
+	}
+};
+
+//Sorts first[0, n), the result lands in buf when to_buf, else in first.
+//The halves are sorted into the other array, so every level merges once
+//and nothing is copied back.
+template<typename RandomIt, typename T, typename Comp>
+struct sort_job {
+	RandomIt first;
+	T *buf;
+	size_t n;
+	bool to_buf;
+	Comp *comp;
+	size_t grain;
+
+	static void run(void *arg) {
+		sort_job *job = static_cast<sort_job *>(arg);
+		size_t h = job->n / 2;
+
+		if (job->n <= job->grain) {
+			merge_sort(job->first, job->n, job->buf, *job->comp);
+			if (job->to_buf)
+				for (size_t i = 0; i < job->n; i++)
+					job->buf[i] = job->first[i];
+			return;
+		}
+		sort_job left = {job->first, job->buf, h, !job->to_buf, job->comp,
+						 job->grain};
+		sort_job right = {job->first + h, job->buf + h, job->n - h,
+						  !job->to_buf, job->comp, job->grain};
+		task_group group;
+		group.run(&run, &left);
+		run(&right);
+		group.wait();
+		if (job->to_buf) {
+			merge_job<RandomIt, RandomIt, T *, Comp> merge = {
+					job->first, h, job->first + h, job->n - h, job->buf,
+					job->comp, job->grain};
+			merge.run(&merge);
+		} else {
+			merge_job<T *, T *, RandomIt, Comp> merge = {
+					job->buf, h, job->buf + h, job->n - h, job->first,
+					job->comp, job->grain};
+			merge.run(&merge);
+		}
+	}
+};
+
+//Stable parallel merge sort, n extra elements of memory.
+template<typename RandomIt, typename Comp>
+void sort(RandomIt first, RandomIt last, Comp comp) {
+	typedef typename remove_const<
+			typename iterator_traits<RandomIt>::value_type>::type T;
+	size_t n = last - first;
+	size_t grain = n / (thread_count() * 8);
+
+	if (n < 2)
+		return;
+	vector<T> buf(first, last);
+	if (thread_count() == 1 || grain < min_grain)
+		grain = thread_count() == 1 ? n : min_grain;
+	sort_job<RandomIt, T, Comp> job = {first, &buf[0], n, false, &comp, grain};
+	job.run(&job);
+}
+
+template<typename RandomIt>
+void sort(RandomIt first, RandomIt last) {
+	typedef typename remove_const<
+			typename iterator_traits<RandomIt>::value_type>::type T;
+
+	par::sort(first, last, less<T>());
+}
+
+template<typename RandomIt, typename Comp>
+void stable_sort(RandomIt first, RandomIt last, Comp comp) {
+	par::sort(first, last, comp);
+}
+
+template<typename RandomIt>
+void stable_sort(RandomIt first, RandomIt last) { par::sort(first, last); }
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_PAR_HPP
@@ -0,0 +1,317 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_PRIORITY_QUEUE_HPP
+#define FT_CONTAINERS_FINAL_PRIORITY_QUEUE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+#include "vector.hpp"
+#include "algorithm.hpp"
+
+namespace ft {
+//ft::priority_queue: a max-heap kept in Container through ft::dary_heap.
+//Arity is the number of children per node, 2, 4 or 8: 4 halves the depth
+//of a binary heap and the children of a node share a cache line for small
+//value types.
+template<typename T, typename Container = ft::vector<T>,
+		typename Compare = std::less<typename Container::value_type>,
+		size_t Arity = 4>
+class priority_queue {
+public:
+	typedef Container							container_type;
+	typedef Compare								value_compare;
+	typedef typename Container::value_type		value_type;
+	typedef typename Container::size_type		size_type;
+	typedef typename Container::reference		reference;
+	typedef typename Container::const_reference	const_reference;
+
+	static const size_t arity = Arity;
+
+protected:
+	typedef dary_heap<Arity> heap;
+
+	Container	c;
+	Compare		comp;
+
+public:
+	explicit priority_queue(const Compare &_comp = Compare(),
+							const Container &cnt = Container())
+			: c(cnt), comp(_comp) { heap::make(c.begin(), c.end(), comp); }
+
+	template<typename InputIterator>
+	priority_queue(InputIterator first, InputIterator last,
+				   const Compare &_comp = Compare(),
+				   const Container &cnt = Container())
+			: c(cnt), comp(_comp) {
+		c.insert(c.end(), first, last);
+		heap::make(c.begin(), c.end(), comp);
+	}
+
+#if __cplusplus >= 201103L
+	void	push(value_type &&val) {
+		c.push_back(std::move(val));
+		heap::push(c.begin(), c.end(), comp);
+	}
+
+	template<typename... Args>
+	void	emplace(Args &&... args) {
+		c.emplace_back(std::forward<Args>(args)...);
+		heap::push(c.begin(), c.end(), comp);
+	}
+#endif
+
+	bool				empty() const {return c.empty();}
+	size_type			size() const {return c.size();}
+	const_reference		top() const {return c.front();}
+
+	void	push(const value_type &val) {
+		c.push_back(val);
+		heap::push(c.begin(), c.end(), comp);
+	}
+
+	void	pop() {
+		heap::pop(c.begin(), c.end(), comp);
+		c.pop_back();
+	}
+
+	//A batch at least as big as the queue is heapified with the rest in
+	//O(n), smaller ones are pushed one by one.
+	template<typename InputIterator>
+	void	push_range(InputIterator first, InputIterator last) {
+		size_type old = c.size();
+
+		c.insert(c.end(), first, last);
+		if (c.size() - old >= old) {
+			heap::make(c.begin(), c.end(), comp);
+			return;
+		}
+		for (size_type i = old + 1; i <= c.size(); i++)
+			heap::push(c.begin(), c.begin() + i, comp);
+	}
+
+	void	swap(priority_queue &x) {
+		Compare tmp = comp;
+
+		c.swap(x.c);
+		comp = x.comp;
+		x.comp = tmp;
+	}
+};
+
+template<typename T, typename Container, typename Compare, size_t Arity>
+const size_t priority_queue<T, Container, Compare, Arity>::arity;
+
+template<typename T, typename Container, typename Compare, size_t Arity>
+void    swap(priority_queue<T, Container, Compare, Arity> &x,
+			 priority_queue<T, Container, Compare, Arity> &y) {x.swap(y);}
+
+//ft::handle_priority_queue: a d-ary max-heap whose elements can be found
+//again. push() returns a handle that stays valid until its element is
+//popped or erased; update(), decrease_key() and erase() take it.
+//Handles are reused after that.
+template<typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class handle_priority_queue {
+public:
+	typedef T				value_type;
+	typedef Compare			value_compare;
+	typedef size_t			size_type;
+	typedef size_t			handle_type;
+	typedef const T			&const_reference;
+
+	static const size_t arity = Arity;
+	static const size_t npos = static_cast<size_t>(-1);
+
+private:
+	struct entry {
+		T val;
+		handle_type handle;
+	};
+
+	vector<entry> heap;
+	//Position in heap of every handle, npos for free ones.
+	vector<size_type> pos;
+	vector<handle_type> free_handles;
+	Compare comp;
+
+	//Utils:
+	void place(size_type i, const entry &e) {
+		heap[i] = e;
+		pos[e.handle] = i;
+	}
+
+	void sift_up(size_type i, const entry &e);
+
+	void sift_down(size_type i, const entry &e);
+
+	void check(handle_type h) const;
+
+public:
+	explicit handle_priority_queue(const Compare &_comp = Compare())
+			: comp(_comp) {}
+
+	//Capacity:
+	bool empty(void) const { return heap.empty(); }
+
+	size_type size(void) const { return heap.size(); }
+
+	//Element acsses:
+	const_reference top(void) const { return heap.front().val; }
+
+	handle_type top_handle(void) const { return heap.front().handle; }
+
+	bool contains(handle_type h) const {
+		return h < pos.size() && pos[h] != npos;
+	}
+
+	const_reference value(handle_type h) const;
+
+	//Modifiers:
+	handle_type push(const value_type &val);
+
+	void pop(void) { erase(top_handle()); }
+
+	//Gives the element of h a new value, it moves up or down.
+	void update(handle_type h, const value_type &val);
+
+	//Gives h a value that does not come after its current one under
+	//Compare, so it only moves towards the top. With std::greater (a
+	//min-queue) that is a smaller key, as in Dijkstra's algorithm.
+	void decrease_key(handle_type h, const value_type &val);
+
+	void erase(handle_type h);
+
+	void clear(void) {
+		heap.clear();
+		pos.clear();
+		free_handles.clear();
+	}
+
+	void swap(handle_priority_queue &x) {
+		Compare tmp = comp;
+
+		heap.swap(x.heap);
+		pos.swap(x.pos);
+		free_handles.swap(x.free_handles);
+		comp = x.comp;
+		x.comp = tmp;
+	}
+};
+
+template<typename T, typename Compare, size_t Arity>
+const size_t handle_priority_queue<T, Compare, Arity>::arity;
+
+template<typename T, typename Compare, size_t Arity>
+const size_t handle_priority_queue<T, Compare, Arity>::npos;
+
+template<typename T, typename Compare, size_t Arity>
+void    swap(handle_priority_queue<T, Compare, Arity> &x,
+			 handle_priority_queue<T, Compare, Arity> &y) {x.swap(y);}
+
+//Utils:
+template<typename T, typename Compare, size_t Arity>
+void ft::handle_priority_queue<T, Compare, Arity>::sift_up(size_type i,
+														   const entry &e) {
+	size_type parent;
+
+	while (i > 0 && comp(heap[parent = (i - 1) / Arity].val, e.val)) {
+		place(i, heap[parent]);
+		i = parent;
+	}
+	place(i, e);
+}
+
+template<typename T, typename Compare, size_t Arity>
+void ft::handle_priority_queue<T, Compare, Arity>::sift_down(size_type i,
+															 const entry &e) {
+	size_type len = heap.size();
+	size_type child;
+
+	while ((child = Arity * i + 1) < len) {
+		size_type end = child + Arity < len ? child + Arity : len;
+		for (size_type c = child + 1; c < end; c++)
+			if (comp(heap[child].val, heap[c].val))
+				child = c;
+		if (!comp(e.val, heap[child].val))
+			break;
+		place(i, heap[child]);
+		i = child;
+	}
+	place(i, e);
+}
+
+template<typename T, typename Compare, size_t Arity>
+void ft::handle_priority_queue<T, Compare, Arity>::check(handle_type h) const {
+	if (!contains(h))
+		throw std::out_of_range("ft::handle_priority_queue: stale handle");
+}
+
+//Element acsses:
+template<typename T, typename Compare, size_t Arity>
+typename ft::handle_priority_queue<T, Compare, Arity>::const_reference
+ft::handle_priority_queue<T, Compare, Arity>::value(handle_type h) const {
+	check(h);
+	return heap[pos[h]].val;
+}
+
+//Modifiers:
+template<typename T, typename Compare, size_t Arity>
+typename ft::handle_priority_queue<T, Compare, Arity>::handle_type
+ft::handle_priority_queue<T, Compare, Arity>::push(const value_type &val) {
+	entry e = {val, pos.size()};
+
+	if (!free_handles.empty()) {
+		e.handle = free_handles.back();
+		free_handles.pop_back();
+	} else
+		pos.push_back(npos);
+	heap.push_back(e);
+	sift_up(heap.size() - 1, e);
+	return e.handle;
+}
+
+template<typename T, typename Compare, size_t Arity>
+void ft::handle_priority_queue<T, Compare, Arity>::update(
+		handle_type h, const value_type &val) {
+	check(h);
+	entry e = {val, h};
+	size_type i = pos[h];
+	if (i > 0 && comp(heap[(i - 1) / Arity].val, val))
+		sift_up(i, e);
+	else
+		sift_down(i, e);
+}
+
+template<typename T, typename Compare, size_t Arity>
+void ft::handle_priority_queue<T, Compare, Arity>::decrease_key(
+		handle_type h, const value_type &val) {
+	check(h);
+	entry e = {val, h};
+	sift_up(pos[h], e);
+}
+
+template<typename T, typename Compare, size_t Arity>
+void ft::handle_priority_queue<T, Compare, Arity>::erase(handle_type h) {
+	check(h);
+	size_type i = pos[h];
+	entry last = heap.back();
+
+	pos[h] = npos;
+	free_handles.push_back(h);
+	heap.pop_back();
+	if (i == heap.size())
+		return;
+	if (i > 0 && comp(heap[(i - 1) / Arity].val, last.val))
+		sift_up(i, last);
+	else
+		sift_down(i, last);
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_PRIORITY_QUEUE_HPP
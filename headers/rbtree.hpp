@@ -7,6 +7,10 @@
 
 #include <cstdlib>
 #include <functional>
+#if __cplusplus >= 201103L
+# include <memory>
+# include <utility>
+#endif
 
 #include "utils.hpp"
 #include "iterators.hpp"
@@ -39,6 +43,12 @@ public:
 	RBTree_node(int c, const data_t &d, node_t *p = NULL, node_t *l = NULL,
 				node_t *r = NULL)
 			: color(c), parent(p), left(l), right(r), data(d), alloc(Allocator()){}
+#if __cplusplus >= 201103L
+	template<typename... Args>
+	RBTree_node(int c, Args &&... args)
+			: color(c), parent(NULL), left(NULL), right(NULL),
+			  data(std::forward<Args>(args)...), alloc(Allocator()){}
+#endif
 	RBTree_node(const node_t &inst)
 			: left(NULL), right(NULL), alloc(Allocator()){*this = inst;}
 
@@ -147,6 +157,81 @@ private:
 		return res;
 	}
 
+	//Returns the node key has to be hung under, or the node that already
+	//holds key (found is set then). NULL for an empty tree.
+	node_t  *findSlot(t_key &key, node_t *hint, bool &found) const
+	{
+		node_t *parent;
+
+		found = false;
+		if (root == NULL)
+			return NULL;
+		parent = getParent(key, hint);
+		found = eq(parent->data.first, key);
+		return parent;
+	}
+
+#if __cplusplus >= 201103L
+	template<typename... Args>
+	node_t  *newNode(Args &&... args)
+	{
+		node_t *node = alloc.allocate(1);
+		try
+		{
+			std::allocator_traits<Allocator>::construct(
+					alloc, node, RED, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			alloc.deallocate(node, 1);
+			throw;
+		}
+		return node;
+	}
+#else
+	node_t  *newNode(const data_t &data)
+	{
+		node_t *node = alloc.allocate(1);
+		alloc.construct(node, node_t(RED, data));
+		return node;
+	}
+#endif
+
+	//Hangs a new node under parent found by findSlot and rebalances.
+	pair<iterator, bool>    link(node_t *node, node_t *parent)
+	{
+		len++;
+		if (parent == NULL)
+		{
+			node->color = BLACK;
+			root = node;
+			min = root;
+			max = root;
+			return ft::make_pair<iterator, bool>(iterator(root, this), true);
+		}
+		if (more(parent->data.first, node->data.first))
+		{
+			parent->left = node;
+			node->parent = parent;
+		}
+		else
+		{
+			parent->right = node;
+			node->parent = parent;
+		}
+		if (parent->color == RED)
+			doBalancingAfterInsert(parent);
+		if (less(node->data.first, min->data.first))
+		{
+			min = node;
+		}
+		else if (more(node->data.first, max->data.first))
+		{
+			max = node;
+		}
+		return ft::make_pair<iterator, bool>(iterator(node, this), true);
+	}
+
 	node_t  *getMin(void) const
 	{
 		node_t *res = root;
@@ -501,45 +586,33 @@ public:
 
 	pair<iterator, bool>    insert(const data_t &data, node_t *parent = NULL)
 	{
-		if (root == NULL)
-		{
-			root = alloc.allocate(1);
-			alloc.construct(root, node_t(BLACK, data));
-			min = root;
-			max = root;
-			len++;
-			return ft::make_pair<iterator, bool>(iterator(root, this), true);
-		}
-		parent = getParent(data.first, parent);
-		if (eq(parent->data.first, data.first))
-		{
+		bool found;
+
+		parent = findSlot(data.first, parent, found);
+		if (found)
 			return ft::make_pair<iterator, bool>(iterator(parent, this), false);
-		}
-		node_t *node = alloc.allocate(1);
-		alloc.construct(node, node_t(RED, data));
-		if (more(parent->data.first, data.first))
-		{
-			parent->left = node;
-			node->parent = parent;
-		}
-		else
-		{
-			parent->right = node;
-			node->parent = parent;
-		}
-		if (parent->color == RED)
-			doBalancingAfterInsert(parent);
-		if (less(node->data.first, min->data.first))
-		{
-			min = node;
-		}
-		else if (more(node->data.first, max->data.first))
-		{
-			max = node;
-		}
-		len++;
-		return ft::make_pair<iterator, bool>(iterator(node, this), true);
+		return link(newNode(data), parent);
+	}
+
+#if __cplusplus >= 201103L
+	//Builds the node data from args only when key is not in the tree yet.
+	//key is not used once the node is built, so it may alias args.
+	template<typename... Args>
+	pair<iterator, bool>    emplace(t_key &key, node_t *hint, Args &&... args)
+	{
+		bool    found;
+		node_t  *parent = findSlot(key, hint, found);
+
+		if (found)
+			return ft::make_pair<iterator, bool>(iterator(parent, this), false);
+		return link(newNode(std::forward<Args>(args)...), parent);
+	}
+
+	pair<iterator, bool>    insert(data_t &&data, node_t *parent = NULL)
+	{
+		return emplace(data.first, parent, std::move(data));
 	}
+#endif
 
 	pair<iterator, bool>    insert(
 			t_key &key, value_t val = NULL, node_t *pos = NULL)
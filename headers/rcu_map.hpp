@@ -0,0 +1,237 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_RCU_MAP_HPP
+#define FT_CONTAINERS_FINAL_RCU_MAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <pthread.h>
+
+#include "map.hpp"
+#include "epoch.hpp"
+
+namespace ft {
+//ft::rcu_map: a read-mostly ft::map (read-copy-update).
+//Readers pin the current version inside an epoch_guard and use it as a
+//plain const ft::map: no lock, no write to shared memory but their own
+//epoch record, so they never wait on each other or on writers.
+//A writer copies the current version, changes the copy and publishes it
+//with one atomic pointer store. The old version is retired to
+//ft::epoch_domain and freed once the readers that could see it are gone.
+//Writers are serialized by a mutex and each one copies the whole map, so
+//batch changes through update().
+template<typename Key, typename Value, typename Compare = std::less<Key>,
+		typename Allocator = std::allocator<pair<const Key, Value> > >
+class rcu_map {
+public:
+	typedef map<Key, Value, Compare, Allocator>	map_type;
+	typedef typename map_type::key_type			key_type;
+	typedef typename map_type::mapped_type		mapped_type;
+	typedef typename map_type::value_type		value_type;
+	typedef typename map_type::size_type		size_type;
+
+	//A pinned version: valid and unchanged as long as the snapshot lives.
+	//Like the epoch_guard in it, a snapshot must not leave the thread.
+	class snapshot {
+		epoch_guard guard;
+		const map_type *version;
+
+	public:
+		explicit snapshot(const map_type *const &current)
+				: version(__atomic_load_n(&current, __ATOMIC_ACQUIRE)) {}
+
+		const map_type &operator*(void) const { return *version; }
+
+		const map_type *operator->(void) const { return version; }
+	};
+
+private:
+	map_type *current;
+	pthread_mutex_t write_lock;
+
+	struct locked {
+		pthread_mutex_t &lock;
+
+		explicit locked(pthread_mutex_t &_lock): lock(_lock) {
+			pthread_mutex_lock(&lock);
+		}
+
+		~locked(void) { pthread_mutex_unlock(&lock); }
+	};
+
+	struct insert_fn {
+		const value_type &val;
+
+		explicit insert_fn(const value_type &_val): val(_val) {}
+
+		void operator()(map_type &m) const { m.insert(val); }
+	};
+
+	struct assign_fn {
+		const value_type &val;
+
+		explicit assign_fn(const value_type &_val): val(_val) {}
+
+		void operator()(map_type &m) const {
+			typename map_type::iterator it = m.find(val.first);
+
+			if (it == m.end())
+				m.insert(val);
+			else
+				it->second = val.second;
+		}
+	};
+
+	struct erase_fn {
+		const key_type &key;
+
+		explicit erase_fn(const key_type &_key): key(_key) {}
+
+		void operator()(map_type &m) const { m.erase(key); }
+	};
+
+	//With write_lock held.
+	template<typename Function>
+	void copy_update(Function fn);
+
+	void publish(map_type *next);
+
+	rcu_map(const rcu_map &);
+
+	rcu_map &operator=(const rcu_map &);
+
+public:
+	rcu_map(void): current(new map_type()) {
+		pthread_mutex_init(&write_lock, NULL);
+	}
+
+	explicit rcu_map(const map_type &init): current(new map_type(init)) {
+		pthread_mutex_init(&write_lock, NULL);
+	}
+
+	//No other thread may use the map any more.
+	~rcu_map(void) {
+		delete current;
+		pthread_mutex_destroy(&write_lock);
+	}
+
+	//Readers:
+	snapshot read(void) const { return snapshot(current); }
+
+	size_type size(void) const { return read()->size(); }
+
+	bool empty(void) const { return read()->empty(); }
+
+	size_type count(const key_type &key) const { return read()->count(key); }
+
+	//Copies the value of key to out, false when key is not there.
+	bool find(const key_type &key, mapped_type &out) const;
+
+	//Writers:
+	//Calls fn(map_type &) on a copy of the current version, then
+	//publishes the copy: readers see all of fn's changes or none.
+	template<typename Function>
+	void update(Function fn);
+
+	bool insert(const value_type &val);
+
+	//Inserts val or overwrites the value of its key.
+	void insert_or_assign(const value_type &val);
+
+	size_type erase(const key_type &key);
+
+	//Replaces the whole content.
+	void store(const map_type &next);
+};
+
+//Readers:
+template<typename Key, typename Value, typename Compare, typename Allocator>
+bool ft::rcu_map<Key, Value, Compare, Allocator>::find(const key_type &key,
+													   mapped_type &out) const {
+	snapshot s = read();
+	typename map_type::const_iterator it = s->find(key);
+
+	if (it == s->end())
+		return false;
+	out = it->second;
+	return true;
+}
+
+//Utils:
+template<typename Key, typename Value, typename Compare, typename Allocator>
+template<typename Function>
+void ft::rcu_map<Key, Value, Compare, Allocator>::copy_update(Function fn) {
+	map_type *next = new map_type(*current);
+
+	try {
+		fn(*next);
+	} catch (...) {
+		delete next;
+		throw;
+	}
+	publish(next);
+}
+
+//With write_lock held.
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void ft::rcu_map<Key, Value, Compare, Allocator>::publish(map_type *next) {
+	map_type *old = current;
+
+	__atomic_store_n(&current, next, __ATOMIC_RELEASE);
+	epoch_retire(old);
+	//Updates are rare: free the older versions now rather than after the
+	//domain's usual batch of retires.
+	epoch_domain::instance().reclaim();
+}
+
+//Writers:
+template<typename Key, typename Value, typename Compare, typename Allocator>
+template<typename Function>
+void ft::rcu_map<Key, Value, Compare, Allocator>::update(Function fn) {
+	locked lock(write_lock);
+
+	copy_update(fn);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+bool ft::rcu_map<Key, Value, Compare, Allocator>::insert(
+		const value_type &val) {
+	locked lock(write_lock);
+
+	if (current->count(val.first))
+		return false;
+	copy_update(insert_fn(val));
+	return true;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void ft::rcu_map<Key, Value, Compare, Allocator>::insert_or_assign(
+		const value_type &val) {
+	locked lock(write_lock);
+
+	copy_update(assign_fn(val));
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename ft::rcu_map<Key, Value, Compare, Allocator>::size_type
+ft::rcu_map<Key, Value, Compare, Allocator>::erase(const key_type &key) {
+	locked lock(write_lock);
+
+	if (!current->count(key))
+		return 0;
+	copy_update(erase_fn(key));
+	return 1;
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void ft::rcu_map<Key, Value, Compare, Allocator>::store(const map_type &next) {
+	locked lock(write_lock);
+
+	publish(new map_type(next));
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_RCU_MAP_HPP
@@ -72,6 +72,23 @@ public:
 		return *this;
 	}
 
+#if __cplusplus >= 201103L
+	set(set &&inst) noexcept
+			: comp(std::move(inst.comp)), alloc(std::move(inst.alloc))
+	{
+		rbt.swap(inst.rbt);
+	}
+
+	set &operator=(set &&inst) noexcept
+	{
+		if (this == &inst)
+			return *this;
+		rbt.clear();
+		rbt.swap(inst.rbt);
+		return *this;
+	}
+#endif
+
 	//Iterators:
 	iterator                begin(void){return rbt.begin();}
 	const_iterator          begin(void) const {return rbt.begin();}
@@ -113,6 +130,19 @@ public:
 		}
 	}
 
+#if __cplusplus >= 201103L
+	pair<iterator, bool>    insert(value_type &&val)
+	{
+		return rbt.emplace(val, NULL, std::move(val), (void *)NULL);
+	}
+
+	template <typename... Args>
+	pair<iterator, bool>    emplace(Args &&... args)
+	{
+		return insert(value_type(std::forward<Args>(args)...));
+	}
+#endif
+
 	void        erase(iterator position){rbt.remove(*position);}
 	size_type   erase(const key_type &key){return rbt.remove(key);}
 	void        erase(iterator first, iterator last)
@@ -0,0 +1,440 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_SHARDED_MAP_HPP
+#define FT_CONTAINERS_FINAL_SHARDED_MAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "utils.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+#include "priority_queue.hpp"
+#include "atomic.hpp"
+
+namespace ft {
+//ft::shard_hash: spreads keys over the shards. Integral keys go through
+//the 64-bit finalizer of MurmurHash3 so that keys with equal low bits do
+//not pile up in one shard; strings use FNV-1a.
+template<typename Key, bool = is_integral<Key>::value>
+struct shard_hash;
+
+template<typename Key>
+struct shard_hash<Key, true> {
+	size_t operator()(Key key) const {
+		uint64_t h = static_cast<uint64_t>(key);
+
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdULL;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ULL;
+		h ^= h >> 33;
+		return static_cast<size_t>(h);
+	}
+};
+
+template<typename T>
+struct shard_hash<T *, false> {
+	size_t operator()(T *key) const {
+		return shard_hash<uintptr_t>()(reinterpret_cast<uintptr_t>(key));
+	}
+};
+
+template<>
+struct shard_hash<std::string, false> {
+	size_t operator()(const std::string &key) const {
+		uint64_t h = 0xcbf29ce484222325ULL;
+
+		for (size_t i = 0; i < key.size(); i++) {
+			h ^= static_cast<unsigned char>(key[i]);
+			h *= 0x100000001b3ULL;
+		}
+		return static_cast<size_t>(h);
+	}
+};
+
+//ft::shard_mutex: one writer or one reader at a time.
+class shard_mutex {
+	pthread_mutex_t m;
+
+	shard_mutex(const shard_mutex &);
+
+	shard_mutex &operator=(const shard_mutex &);
+
+public:
+	shard_mutex(void) { pthread_mutex_init(&m, NULL); }
+
+	~shard_mutex(void) { pthread_mutex_destroy(&m); }
+
+	void lock(void) { pthread_mutex_lock(&m); }
+
+	void unlock(void) { pthread_mutex_unlock(&m); }
+
+	void lock_shared(void) { pthread_mutex_lock(&m); }
+
+	void unlock_shared(void) { pthread_mutex_unlock(&m); }
+};
+
+//ft::shard_rwlock: one writer or many readers. Pays off when lookups
+//dominate a shard; a plain mutex is cheaper to take.
+class shard_rwlock {
+	pthread_rwlock_t m;
+
+	shard_rwlock(const shard_rwlock &);
+
+	shard_rwlock &operator=(const shard_rwlock &);
+
+public:
+	shard_rwlock(void) { pthread_rwlock_init(&m, NULL); }
+
+	~shard_rwlock(void) { pthread_rwlock_destroy(&m); }
+
+	void lock(void) { pthread_rwlock_wrlock(&m); }
+
+	void unlock(void) { pthread_rwlock_unlock(&m); }
+
+	void lock_shared(void) { pthread_rwlock_rdlock(&m); }
+
+	void unlock_shared(void) { pthread_rwlock_unlock(&m); }
+};
+
+//ft::sharded_map: a map for write-heavy use by many threads. Keys are
+//hashed to one of N ft::maps, each behind its own lock, so threads that
+//touch different shards do not wait on each other.
+//Every shard sits on its own cache lines: taking one lock does not steal
+//the line of the next. Single key operations lock one shard; size(),
+//clear() and for_each_ordered() lock all of them in index order, which
+//makes them consistent and cannot deadlock with the others.
+//Lock is ft::shard_mutex or ft::shard_rwlock.
+template<typename Key, typename Value, typename Compare = std::less<Key>,
+		typename Hash = shard_hash<Key>, typename Lock = shard_mutex>
+class sharded_map {
+public:
+	typedef map<Key, Value, Compare>			map_type;
+	typedef typename map_type::key_type			key_type;
+	typedef typename map_type::mapped_type		mapped_type;
+	typedef typename map_type::value_type		value_type;
+	typedef typename map_type::size_type		size_type;
+	typedef Compare								key_compare;
+	typedef Hash								hasher;
+
+private:
+	struct shard {
+		Lock lock;
+		map_type map;
+		char pad[cache_line];
+	};
+
+	//A shard position in for_each_ordered(), the heap keeps the smallest
+	//key on top.
+	struct cursor {
+		typename map_type::const_iterator it;
+		typename map_type::const_iterator end;
+	};
+
+	struct cursor_after {
+		Compare comp;
+
+		explicit cursor_after(const Compare &_comp): comp(_comp) {}
+
+		bool operator()(const cursor &a, const cursor &b) const {
+			return comp(b.it->first, a.it->first);
+		}
+	};
+
+	shard *shards;
+	size_type mask;
+	Hash hash;
+	Compare comp;
+
+	void lock_all(void) const {
+		for (size_type i = 0; i <= mask; i++)
+			shards[i].lock.lock_shared();
+	}
+
+	void unlock_all(void) const {
+		for (size_type i = 0; i <= mask; i++)
+			shards[i].lock.unlock_shared();
+	}
+
+	sharded_map(const sharded_map &);
+
+	sharded_map &operator=(const sharded_map &);
+
+public:
+	//shard_count is rounded up to a power of two, a few per core is a
+	//good start.
+	explicit sharded_map(size_type shard_count = 64,
+						 const Compare &_comp = Compare(),
+						 const Hash &_hash = Hash());
+
+	~sharded_map(void) { delete[] shards; }
+
+	//Capacity:
+	size_type size(void) const;
+
+	bool empty(void) const { return size() == 0; }
+
+	//Element acsses:
+	//Copies the value of key to out, false when key is not there.
+	bool find(const key_type &key, mapped_type &out) const;
+
+	size_type count(const key_type &key) const;
+
+	//Modifiers:
+	bool insert(const value_type &val);
+
+	//Inserts val or overwrites the value of its key.
+	void insert_or_assign(const value_type &val);
+
+	size_type erase(const key_type &key);
+
+	void clear(void);
+
+	//Bulk: the range is grouped by shard first, then every shard is
+	//locked once for all of its elements. Returns how many were new.
+	template<typename InputIterator>
+	size_type insert(InputIterator first, InputIterator last);
+
+	//Shards:
+	size_type shard_count(void) const { return mask + 1; }
+
+	size_type shard_of(const key_type &key) const { return hash(key) & mask; }
+
+	//Calls fn(map_type &) with shard i locked for writing. fn must not
+	//move keys to another shard.
+	template<typename Function>
+	Function with_shard(size_type i, Function fn);
+
+	//Calls fn(const map_type &) with shard i locked for reading.
+	template<typename Function>
+	Function with_shard(size_type i, Function fn) const;
+
+	//Calls fn(const value_type &) on every element in key order, merging
+	//the shards with a heap. All shards stay locked for reading meanwhile:
+	//fn sees one consistent state and must not call back into the map.
+	template<typename Function>
+	Function for_each_ordered(Function fn) const;
+};
+
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+ft::sharded_map<Key, Value, Compare, Hash, Lock>::sharded_map(
+		size_type shard_count, const Compare &_comp, const Hash &_hash)
+		: shards(NULL), mask(0), hash(_hash), comp(_comp) {
+	size_type n = 1;
+
+	while (n < shard_count)
+		n <<= 1;
+	shards = new shard[n];
+	mask = n - 1;
+}
+
+//Capacity:
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+typename ft::sharded_map<Key, Value, Compare, Hash, Lock>::size_type
+ft::sharded_map<Key, Value, Compare, Hash, Lock>::size(void) const {
+	size_type n = 0;
+
+	lock_all();
+	for (size_type i = 0; i <= mask; i++)
+		n += shards[i].map.size();
+	unlock_all();
+	return n;
+}
+
+//Element acsses:
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+bool ft::sharded_map<Key, Value, Compare, Hash, Lock>::find(
+		const key_type &key, mapped_type &out) const {
+	shard &s = shards[shard_of(key)];
+	bool found;
+
+	s.lock.lock_shared();
+	typename map_type::const_iterator it = s.map.find(key);
+	found = it != s.map.end();
+	if (found)
+		out = it->second;
+	s.lock.unlock_shared();
+	return found;
+}
+
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+typename ft::sharded_map<Key, Value, Compare, Hash, Lock>::size_type
+ft::sharded_map<Key, Value, Compare, Hash, Lock>::count(
+		const key_type &key) const {
+	shard &s = shards[shard_of(key)];
+	size_type n;
+
+	s.lock.lock_shared();
+	n = s.map.count(key);
+	s.lock.unlock_shared();
+	return n;
+}
+
+//Modifiers:
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+bool ft::sharded_map<Key, Value, Compare, Hash, Lock>::insert(
+		const value_type &val) {
+	shard &s = shards[shard_of(val.first)];
+	bool inserted;
+
+	s.lock.lock();
+	try {
+		inserted = s.map.insert(val).second;
+	} catch (...) {
+		s.lock.unlock();
+		throw;
+	}
+	s.lock.unlock();
+	return inserted;
+}
+
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+void ft::sharded_map<Key, Value, Compare, Hash, Lock>::insert_or_assign(
+		const value_type &val) {
+	shard &s = shards[shard_of(val.first)];
+
+	s.lock.lock();
+	try {
+		pair<typename map_type::iterator, bool> res = s.map.insert(val);
+		if (!res.second)
+			res.first->second = val.second;
+	} catch (...) {
+		s.lock.unlock();
+		throw;
+	}
+	s.lock.unlock();
+}
+
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+typename ft::sharded_map<Key, Value, Compare, Hash, Lock>::size_type
+ft::sharded_map<Key, Value, Compare, Hash, Lock>::erase(const key_type &key) {
+	shard &s = shards[shard_of(key)];
+	size_type n;
+
+	s.lock.lock();
+	n = s.map.erase(key);
+	s.lock.unlock();
+	return n;
+}
+
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+void ft::sharded_map<Key, Value, Compare, Hash, Lock>::clear(void) {
+	for (size_type i = 0; i <= mask; i++)
+		shards[i].lock.lock();
+	for (size_type i = 0; i <= mask; i++) {
+		shards[i].map.clear();
+		shards[i].lock.unlock();
+	}
+}
+
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+template<typename InputIterator>
+typename ft::sharded_map<Key, Value, Compare, Hash, Lock>::size_type
+ft::sharded_map<Key, Value, Compare, Hash, Lock>::insert(InputIterator first,
+														 InputIterator last) {
+	vector<vector<pair<key_type, mapped_type> > > groups(mask + 1);
+	size_type inserted = 0;
+
+	for (; first != last; ++first)
+		groups[shard_of(first->first)].push_back(
+				pair<key_type, mapped_type>(first->first, first->second));
+	for (size_type i = 0; i <= mask; i++) {
+		if (groups[i].empty())
+			continue;
+		shards[i].lock.lock();
+		try {
+			for (size_type j = 0; j < groups[i].size(); j++)
+				inserted += shards[i].map.insert(value_type(
+						groups[i][j].first, groups[i][j].second)).second;
+		} catch (...) {
+			shards[i].lock.unlock();
+			throw;
+		}
+		shards[i].lock.unlock();
+	}
+	return inserted;
+}
+
+//Shards:
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+template<typename Function>
+Function ft::sharded_map<Key, Value, Compare, Hash, Lock>::with_shard(
+		size_type i, Function fn) {
+	shards[i].lock.lock();
+	try {
+		fn(shards[i].map);
+	} catch (...) {
+		shards[i].lock.unlock();
+		throw;
+	}
+	shards[i].lock.unlock();
+	return fn;
+}
+
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+template<typename Function>
+Function ft::sharded_map<Key, Value, Compare, Hash, Lock>::with_shard(
+		size_type i, Function fn) const {
+	const map_type &m = shards[i].map;
+
+	shards[i].lock.lock_shared();
+	try {
+		fn(m);
+	} catch (...) {
+		shards[i].lock.unlock_shared();
+		throw;
+	}
+	shards[i].lock.unlock_shared();
+	return fn;
+}
+
+template<typename Key, typename Value, typename Compare, typename Hash,
+		typename Lock>
+template<typename Function>
+Function ft::sharded_map<Key, Value, Compare, Hash, Lock>::for_each_ordered(
+		Function fn) const {
+	priority_queue<cursor, vector<cursor>, cursor_after, 4> heap(
+			(cursor_after(comp)));
+
+	lock_all();
+	try {
+		for (size_type i = 0; i <= mask; i++) {
+			cursor c = {shards[i].map.begin(), shards[i].map.end()};
+			if (c.it != c.end)
+				heap.push(c);
+		}
+		while (!heap.empty()) {
+			cursor c = heap.top();
+			heap.pop();
+			fn(*c.it);
+			if (++c.it != c.end)
+				heap.push(c);
+		}
+	} catch (...) {
+		unlock_all();
+		throw;
+	}
+	unlock_all();
+	return fn;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_SHARDED_MAP_HPP
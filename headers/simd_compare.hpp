@@ -0,0 +1,237 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_SIMD_COMPARE_HPP
+#define FT_CONTAINERS_FINAL_SIMD_COMPARE_HPP
+
+#include <cstddef>
+#include <cstring>
+#if defined(__AVX2__)
+# include <immintrin.h>
+#elif defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+//Kernels behind the contiguous fast paths of ft::equal and
+//ft::lexicographical_compare. The SSE2 loops are always on for x86-64, the
+//AVX2 ones only when the code is built with -mavx2 (or -march=native).
+//Elsewhere they fall back to plain loops.
+namespace ft {
+namespace simd {
+//Index of the lowest set bit of m, m != 0.
+inline size_t first_set(unsigned int m) {
+#if defined(__GNUC__)
+	return __builtin_ctz(m);
+#else
+	size_t i = 0;
+
+	while (!(m & 1u)) {
+		m >>= 1;
+		i++;
+	}
+	return i;
+#endif
+}
+
+//Index of the first byte where a and b differ, n when they are equal.
+inline size_t mismatch_bytes(const unsigned char *a, const unsigned char *b,
+							 size_t n) {
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 64 <= n; i += 64) {
+		__m256i e0 = _mm256_cmpeq_epi8(
+				_mm256_loadu_si256((const __m256i *)(a + i)),
+				_mm256_loadu_si256((const __m256i *)(b + i)));
+		__m256i e1 = _mm256_cmpeq_epi8(
+				_mm256_loadu_si256((const __m256i *)(a + i + 32)),
+				_mm256_loadu_si256((const __m256i *)(b + i + 32)));
+		if ((unsigned int)_mm256_movemask_epi8(_mm256_and_si256(e0, e1))
+			== 0xFFFFFFFFu)
+			continue;
+		unsigned int m = ~(unsigned int)_mm256_movemask_epi8(e0);
+		if (m)
+			return i + first_set(m);
+		return i + 32 + first_set(~(unsigned int)_mm256_movemask_epi8(e1));
+	}
+#endif
+#if defined(__SSE2__)
+	for (; i + 64 <= n; i += 64) {
+		__m128i e[4];
+		for (int k = 0; k < 4; k++)
+			e[k] = _mm_cmpeq_epi8(
+					_mm_loadu_si128((const __m128i *)(a + i + 16 * k)),
+					_mm_loadu_si128((const __m128i *)(b + i + 16 * k)));
+		if (_mm_movemask_epi8(_mm_and_si128(_mm_and_si128(e[0], e[1]),
+											_mm_and_si128(e[2], e[3])))
+			== 0xFFFF)
+			continue;
+		for (int k = 0; k < 4; k++) {
+			unsigned int m = ~_mm_movemask_epi8(e[k]) & 0xFFFFu;
+			if (m)
+				return i + 16 * k + first_set(m);
+		}
+	}
+	for (; i + 16 <= n; i += 16) {
+		unsigned int m = ~_mm_movemask_epi8(_mm_cmpeq_epi8(
+				_mm_loadu_si128((const __m128i *)(a + i)),
+				_mm_loadu_si128((const __m128i *)(b + i)))) & 0xFFFFu;
+		if (m)
+			return i + first_set(m);
+	}
+#endif
+	for (; i < n; i++)
+		if (a[i] != b[i])
+			return i;
+	return n;
+}
+
+//Index of the first element where a[i] != b[i], n when none. T is an
+//integral type, so two elements are equal exactly when their bytes are.
+template<typename T>
+size_t mismatch(const T *a, const T *b, size_t n) {
+	return mismatch_bytes(reinterpret_cast<const unsigned char *>(a),
+						  reinterpret_cast<const unsigned char *>(b),
+						  n * sizeof(T)) / sizeof(T);
+}
+
+//Floating point compares by value: NaN differs from everything, even
+//itself, and 0.0 equals -0.0.
+inline size_t mismatch(const float *a, const float *b, size_t n) {
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 16 <= n; i += 16) {
+		__m256 d0 = _mm256_cmp_ps(_mm256_loadu_ps(a + i),
+								  _mm256_loadu_ps(b + i), _CMP_NEQ_UQ);
+		__m256 d1 = _mm256_cmp_ps(_mm256_loadu_ps(a + i + 8),
+								  _mm256_loadu_ps(b + i + 8), _CMP_NEQ_UQ);
+		if (!_mm256_movemask_ps(_mm256_or_ps(d0, d1)))
+			continue;
+		unsigned int m = _mm256_movemask_ps(d0)
+						 | (unsigned int)_mm256_movemask_ps(d1) << 8;
+		return i + first_set(m);
+	}
+#endif
+#if defined(__SSE2__)
+	for (; i + 16 <= n; i += 16) {
+		__m128 d[4];
+		for (int k = 0; k < 4; k++)
+			d[k] = _mm_cmpneq_ps(_mm_loadu_ps(a + i + 4 * k),
+								 _mm_loadu_ps(b + i + 4 * k));
+		if (!_mm_movemask_ps(_mm_or_ps(_mm_or_ps(d[0], d[1]),
+									   _mm_or_ps(d[2], d[3]))))
+			continue;
+		unsigned int m = 0;
+		for (int k = 0; k < 4; k++)
+			m |= (unsigned int)_mm_movemask_ps(d[k]) << (4 * k);
+		return i + first_set(m);
+	}
+#endif
+	for (; i < n; i++)
+		if (a[i] != b[i])
+			return i;
+	return n;
+}
+
+inline size_t mismatch(const double *a, const double *b, size_t n) {
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 8 <= n; i += 8) {
+		__m256d d0 = _mm256_cmp_pd(_mm256_loadu_pd(a + i),
+								   _mm256_loadu_pd(b + i), _CMP_NEQ_UQ);
+		__m256d d1 = _mm256_cmp_pd(_mm256_loadu_pd(a + i + 4),
+								   _mm256_loadu_pd(b + i + 4), _CMP_NEQ_UQ);
+		if (!_mm256_movemask_pd(_mm256_or_pd(d0, d1)))
+			continue;
+		unsigned int m = _mm256_movemask_pd(d0)
+						 | (unsigned int)_mm256_movemask_pd(d1) << 4;
+		return i + first_set(m);
+	}
+#endif
+#if defined(__SSE2__)
+	for (; i + 8 <= n; i += 8) {
+		__m128d d[4];
+		for (int k = 0; k < 4; k++)
+			d[k] = _mm_cmpneq_pd(_mm_loadu_pd(a + i + 2 * k),
+								 _mm_loadu_pd(b + i + 2 * k));
+		if (!_mm_movemask_pd(_mm_or_pd(_mm_or_pd(d[0], d[1]),
+									   _mm_or_pd(d[2], d[3]))))
+			continue;
+		unsigned int m = 0;
+		for (int k = 0; k < 4; k++)
+			m |= (unsigned int)_mm_movemask_pd(d[k]) << (2 * k);
+		return i + first_set(m);
+	}
+#endif
+	for (; i < n; i++)
+		if (a[i] != b[i])
+			return i;
+	return n;
+}
+
+//a[0, n) == b[0, n). Integers are equal when their bytes are, so memcmp
+//does it with libc's own vector code.
+template<typename T>
+bool equal(const T *a, const T *b, size_t n) {
+	return n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0;
+}
+
+inline bool equal(const float *a, const float *b, size_t n) {
+	return mismatch(a, b, n) == n;
+}
+
+inline bool equal(const double *a, const double *b, size_t n) {
+	return mismatch(a, b, n) == n;
+}
+
+//a[0, n1) < b[0, n2) lexicographically, integral T.
+template<typename T>
+bool less(const T *a, size_t n1, const T *b, size_t n2) {
+	size_t n = n1 < n2 ? n1 : n2;
+	size_t i = mismatch(a, b, n);
+
+	if (i == n)
+		return n1 < n2;
+	return a[i] < b[i];
+}
+
+//Unsigned bytes order like memcmp does.
+inline bool less(const unsigned char *a, size_t n1, const unsigned char *b,
+				 size_t n2) {
+	size_t n = n1 < n2 ? n1 : n2;
+	int r = n == 0 ? 0 : std::memcmp(a, b, n);
+
+	return r < 0 || (r == 0 && n1 < n2);
+}
+
+//Unordered pairs (a NaN on either side) are skipped like the generic loop
+//does: neither element is less than the other one.
+template<typename F>
+bool less_floating(const F *a, size_t n1, const F *b, size_t n2) {
+	size_t n = n1 < n2 ? n1 : n2;
+	size_t i = 0;
+
+	while ((i += mismatch(a + i, b + i, n - i)) < n) {
+		if (a[i] < b[i])
+			return true;
+		if (b[i] < a[i])
+			return false;
+		i++;
+	}
+	return n1 < n2;
+}
+
+inline bool less(const float *a, size_t n1, const float *b, size_t n2) {
+	return less_floating(a, n1, b, n2);
+}
+
+inline bool less(const double *a, size_t n1, const double *b, size_t n2) {
+	return less_floating(a, n1, b, n2);
+}
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_SIMD_COMPARE_HPP
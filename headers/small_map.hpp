@@ -0,0 +1,631 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_SMALL_MAP_HPP
+#define FT_CONTAINERS_FINAL_SMALL_MAP_HPP
+
+#include <cstddef>
+
+#include "rbtree.hpp"
+#include "vector.hpp"
+
+namespace ft{
+//ft::small_map: ft::map which keeps up to N entries sorted inside the object
+//and moves them into the RBTree only when the N + 1 entry is inserted.
+//Inline inserts and erases invalidate iterators behind the position (as in
+//ft::vector), spilling into the tree invalidates all of them.
+template <
+		typename Key, typename Value, size_t N = 8,
+		typename Compare = std::less<Key>,
+		typename Allocator = std::allocator<pair<const Key, Value> > >
+class small_map
+{
+	typedef typename
+	ft::RBTree<typename Allocator::value_type, Compare, Allocator>  rbtree_t;
+
+	template<bool IsConst>
+	struct common_iterator;
+
+public:
+	typedef Key                                         key_type;
+	typedef Value                                       mapped_type;
+	typedef Compare                                     key_compare;
+	typedef Allocator                                   allocator_type;
+	typedef typename rbtree_t::data_t                   value_type;
+	typedef typename allocator_type::reference          reference;
+	typedef typename allocator_type::const_reference    const_reference;
+	typedef typename allocator_type::pointer            pointer;
+	typedef typename allocator_type::const_pointer      const_pointer;
+	typedef typename allocator_type::size_type          size_type;
+
+	typedef small_map::common_iterator<NotConst>        iterator;
+	typedef small_map::common_iterator<Const>           const_iterator;
+	typedef common_reverse_iterator<iterator>           reverse_iterator;
+	typedef common_reverse_iterator<const_iterator>     const_reverse_iterator;
+
+private:
+	union storage_t
+	{
+		char        buf[N * sizeof(value_type)];
+		long double align_ld;
+		long long   align_ll;
+		void        *align_ptr;
+	};
+
+	key_compare     comp;
+	allocator_type  alloc;
+	storage_t       storage;
+	size_type       len;
+	bool            spilled;
+	rbtree_t        rbt;
+
+private:
+	value_type          *items(void)
+	{
+		return reinterpret_cast<value_type*>(storage.buf);
+	}
+
+	const value_type    *items(void) const
+	{
+		return reinterpret_cast<const value_type*>(storage.buf);
+	}
+
+	//First inline index whose key is not less than key.
+	size_type   lowerIndex(const key_type &key) const
+	{
+		size_type lo = 0;
+		size_type hi = len;
+
+		while (lo < hi)
+		{
+			size_type mid = lo + (hi - lo) / 2;
+			if (comp(items()[mid].first, key))
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return lo;
+	}
+
+	//First inline index whose key is greater than key.
+	size_type   upperIndex(const key_type &key) const
+	{
+		size_type lo = 0;
+		size_type hi = len;
+
+		while (lo < hi)
+		{
+			size_type mid = lo + (hi - lo) / 2;
+			if (comp(key, items()[mid].first))
+				hi = mid;
+			else
+				lo = mid + 1;
+		}
+		return lo;
+	}
+
+	bool        foundAt(size_type i, const key_type &key) const
+	{
+		return i < len && !comp(key, items()[i].first);
+	}
+
+	void        destroyInline(void)
+	{
+		for (size_type i = 0; i < len; i++)
+			alloc.destroy(&items()[i]);
+		len = 0;
+	}
+
+	void        spill(void)
+	{
+		for (size_type i = 0; i < len; i++)
+			rbt.insert(items()[i]);
+		destroyInline();
+		spilled = true;
+	}
+
+	void        insertAt(size_type i, const value_type &val)
+	{
+		value_type *arr = items();
+
+		for (size_type j = len; j > i; j--)
+		{
+			alloc.construct(&arr[j], arr[j - 1]);
+			alloc.destroy(&arr[j - 1]);
+		}
+		alloc.construct(&arr[i], val);
+		len++;
+	}
+
+	void        eraseAt(size_type i)
+	{
+		value_type *arr = items();
+
+		alloc.destroy(&arr[i]);
+		for (size_type j = i + 1; j < len; j++)
+		{
+			alloc.construct(&arr[j - 1], arr[j]);
+			alloc.destroy(&arr[j]);
+		}
+		len--;
+	}
+
+	void        copyFrom(const small_map &inst)
+	{
+		if (inst.spilled)
+		{
+			rbt = inst.rbt;
+			spilled = true;
+			return ;
+		}
+		for (size_type i = 0; i < inst.len; i++)
+		{
+			alloc.construct(&items()[i], inst.items()[i]);
+			len++;
+		}
+	}
+
+public:
+	explicit small_map(const key_compare &_comp = key_compare(),
+					   const allocator_type &_alloc = allocator_type())
+			: comp(_comp), alloc(_alloc), len(0), spilled(false){}
+
+	template <typename InputIterator>
+	small_map(InputIterator first,
+			  typename ft::IsInputIter<InputIterator>::type last,
+			  const key_compare &_comp = key_compare(),
+			  const allocator_type &_alloc = allocator_type())
+			: comp(_comp), alloc(_alloc), len(0), spilled(false)
+	{
+		while (first != last)
+		{
+			insert(*first++);
+		}
+	}
+
+	small_map(const small_map &inst)
+			: comp(inst.comp), alloc(inst.alloc), len(0), spilled(false)
+	{
+		copyFrom(inst);
+	}
+
+	~small_map(void){destroyInline();}
+
+	small_map   &operator=(const small_map &inst)
+	{
+		if (this == &inst)
+			return *this;
+		clear();
+		copyFrom(inst);
+		return *this;
+	}
+
+	//Iterators:
+	iterator                begin(void)
+	{
+		if (spilled)
+			return iterator(rbt.begin());
+		return iterator(items());
+	}
+
+	const_iterator          begin(void) const
+	{
+		if (spilled)
+			return const_iterator(rbt.begin());
+		return const_iterator(items());
+	}
+
+	iterator                end(void)
+	{
+		if (spilled)
+			return iterator(rbt.end());
+		return iterator(items() + len);
+	}
+
+	const_iterator          end(void) const
+	{
+		if (spilled)
+			return const_iterator(rbt.end());
+		return const_iterator(items() + len);
+	}
+
+	reverse_iterator        rbegin(void){return reverse_iterator(end());}
+	const_reverse_iterator  rbegin(void) const
+	{
+		return const_reverse_iterator(end());
+	}
+	reverse_iterator        rend(void){return reverse_iterator(begin());}
+	const_reverse_iterator  rend(void) const
+	{
+		return const_reverse_iterator(begin());
+	}
+	const_iterator          cbegin(void) const {return begin();}
+	const_iterator          cend(void) const {return end();}
+	const_reverse_iterator  crbegin(void) const {return rbegin();}
+	const_reverse_iterator  crend(void) const {return rend();}
+
+	//Capacity:
+	bool    empty(void) const {return size() == 0;}
+	size_t  size(void) const {return spilled ? rbt.size() : len;}
+	size_t  max_size(void) const {return rbt.max_size();}
+
+	//true while the entries still live in the inline storage.
+	bool    is_inline(void) const {return !spilled;}
+	static size_t  inline_capacity(void) {return N;}
+
+	//Element access:
+	mapped_type    &operator[](const key_type &key)
+	{
+		return insert(value_type(key, mapped_type())).first->second;
+	}
+
+	//Modifiers:
+	pair<iterator, bool>    insert(const value_type &val)
+	{
+		if (!spilled)
+		{
+			size_type i = lowerIndex(val.first);
+			if (foundAt(i, val.first))
+				return ft::make_pair<iterator, bool>(iterator(items() + i), false);
+			if (len < N)
+			{
+				insertAt(i, val);
+				return ft::make_pair<iterator, bool>(iterator(items() + i), true);
+			}
+			spill();
+		}
+		pair<typename rbtree_t::iterator, bool> res = rbt.insert(val);
+		return ft::make_pair<iterator, bool>(iterator(res.first), res.second);
+	}
+
+	iterator                insert(iterator position, const value_type& val)
+	{
+		(void)position;
+		return insert(val).first;
+	}
+
+	template <class InputIterator>
+	void        insert (InputIterator first, InputIterator last)
+	{
+		while (first != last)
+		{
+			insert(value_type(first->first, first->second));
+			first++;
+		}
+	}
+
+	void        erase(iterator position){erase(position->first);}
+	size_type   erase(const key_type &key)
+	{
+		if (spilled)
+			return rbt.remove(key);
+		size_type i = lowerIndex(key);
+		if (!foundAt(i, key))
+			return 0;
+		eraseAt(i);
+		return 1;
+	}
+
+	void        erase(iterator first, iterator last)
+	{
+		vector<key_type>                    keys;
+		typename vector<key_type>::iterator it;
+		typename vector<key_type>::iterator ite;
+
+		while (first != last)
+		{
+			keys.push_back(first->first);
+			first++;
+		}
+		it = keys.begin();
+		ite = keys.end();
+		while (it != ite)
+		{
+			erase(*it++);
+		}
+	}
+
+	void        swap(small_map &inst)
+	{
+		if (this == &inst)
+			return ;
+		if (spilled && inst.spilled)
+		{
+			rbt.swap(inst.rbt);
+			return ;
+		}
+		small_map tmp(inst);
+		inst = *this;
+		*this = tmp;
+	}
+
+	//Drops the tree too, the map goes back to the inline storage.
+	void        clear(void)
+	{
+		destroyInline();
+		rbt.clear();
+		spilled = false;
+	}
+
+	//Operations:
+	iterator        find(const key_type &key)
+	{
+		if (spilled)
+			return iterator(typename rbtree_t::iterator(rbt.findNode(key), &rbt));
+		size_type i = lowerIndex(key);
+		return iterator(items() + (foundAt(i, key) ? i : len));
+	}
+
+	const_iterator  find(const key_type &key) const
+	{
+		if (spilled)
+			return const_iterator(
+					typename rbtree_t::const_iterator(rbt.findNode(key), &rbt));
+		size_type i = lowerIndex(key);
+		return const_iterator(items() + (foundAt(i, key) ? i : len));
+	}
+
+	size_type       count(const key_type &key) const
+	{
+		if (spilled)
+			return rbt.findNode(key) == NULL ? 0 : 1;
+		return foundAt(lowerIndex(key), key) ? 1 : 0;
+	}
+
+	iterator        lower_bound(const key_type &key)
+	{
+		if (!spilled)
+			return iterator(items() + lowerIndex(key));
+		iterator it = begin();
+		iterator ite = end();
+		while (it != ite && comp(it->first, key))
+		{
+			++it;
+		}
+		return it;
+	}
+
+	const_iterator  lower_bound(const key_type &key) const
+	{
+		if (!spilled)
+			return const_iterator(items() + lowerIndex(key));
+		const_iterator it = begin();
+		const_iterator ite = end();
+		while (it != ite && comp(it->first, key))
+		{
+			++it;
+		}
+		return it;
+	}
+
+	iterator        upper_bound(const key_type &key)
+	{
+		if (!spilled)
+			return iterator(items() + upperIndex(key));
+		iterator it = begin();
+		iterator ite = end();
+		while (it != ite && !comp(key, it->first))
+		{
+			++it;
+		}
+		return it;
+	}
+
+	const_iterator  upper_bound(const key_type &key) const
+	{
+		if (!spilled)
+			return const_iterator(items() + upperIndex(key));
+		const_iterator it = begin();
+		const_iterator ite = end();
+		while (it != ite && !comp(key, it->first))
+		{
+			++it;
+		}
+		return it;
+	}
+
+	pair<iterator, iterator>             equal_range(const key_type &key)
+	{
+		return make_pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+	}
+
+	pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+	{
+		return make_pair<const_iterator, const_iterator>(
+				lower_bound(key), upper_bound(key));
+	}
+
+	//Allocator:
+	allocator_type get_allocator(void) const {return alloc;}
+
+	class value_compare
+	{
+		friend class small_map;
+
+	protected:
+		Compare comp;
+
+		value_compare(Compare c): comp(c){}
+
+	public:
+		typedef bool                            result_type;
+		typedef typename small_map::value_type  first_argument_type;
+		typedef typename small_map::value_type  second_argument_type;
+
+		bool operator() (const value_type& x, const value_type& y) const
+		{
+			return comp(x.first, y.first);
+		}
+	};
+
+	//Observers:
+	key_compare     key_comp(void) const {return comp;}
+	value_compare   value_comp(void) const
+	{
+		return value_compare(comp);
+	}
+};
+
+//Iterator over either the inline array or the tree: item is NULL in tree mode.
+template <typename Key, typename Value, size_t N,
+		typename Compare, typename Allocator>
+template<bool IsConst>
+struct ft::small_map<Key, Value, N, Compare, Allocator>::common_iterator
+		: public iterator_base<std::bidirectional_iterator_tag,
+				typename conditional<IsConst, value_type, const value_type>::type>
+{
+	typedef
+	typename conditional_t<IsConst, value_type, const value_type>::type value_t;
+
+	typedef
+	typename conditional_t<IsConst, iterator, const_iterator>::type     iter_t;
+
+	typedef
+	typename conditional_t<IsConst, typename rbtree_t::iterator,
+			typename rbtree_t::const_iterator>::type                    tree_iter_t;
+
+private:
+	value_t     *item;
+	tree_iter_t node;
+
+public:
+	common_iterator(void): item(NULL), node(){}
+	common_iterator(value_t *_item): item(_item), node(){}
+	common_iterator(const tree_iter_t &_node): item(NULL), node(_node){}
+	common_iterator(const iterator &inst)
+			: item(inst.inlineItem()), node(inst.treeIter()){}
+	~common_iterator(void){}
+
+	iter_t  &operator=(const iterator &inst)
+	{
+		item = inst.inlineItem();
+		node = inst.treeIter();
+		return *this;
+	}
+
+	iter_t  &operator++(void)
+	{
+		if (item)
+			++item;
+		else
+			++node;
+		return *this;
+	}
+
+	iter_t  operator++(int)
+	{
+		iter_t cur = *this;
+		++(*this);
+		return cur;
+	}
+
+	iter_t  &operator--(void)
+	{
+		if (item)
+			--item;
+		else
+			--node;
+		return *this;
+	}
+
+	iter_t  operator--(int)
+	{
+		iter_t cur = *this;
+		--(*this);
+		return cur;
+	}
+
+	value_t &operator*(void) const
+	{
+		if (item)
+			return *item;
+		return *node;
+	}
+
+	value_t *operator->(void) const
+	{
+		if (item)
+			return item;
+		return &(*node);
+	}
+
+	//Identity for the common comparison operators in iterators.hpp.
+	const void  *base(void) const
+	{
+		if (item)
+			return item;
+		return node.base();
+	}
+
+	value_t             *inlineItem(void) const {return item;}
+	const tree_iter_t   &treeIter(void) const {return node;}
+
+	void    swap(iter_t &rhs)
+	{
+		iter_t tmp = *this;
+		*this = rhs;
+		rhs = tmp;
+	}
+};
+
+
+//std::swap overload
+template <typename Key, typename Value, size_t N,
+		typename Compare, typename Allocator>
+void    swap(ft::small_map<Key, Value, N, Compare, Allocator> &lhs,
+			 ft::small_map<Key, Value, N, Compare, Allocator> &rhs)
+{
+	lhs.swap(rhs);
+}
+
+//Comparee operators:
+template <typename Key, typename Value, size_t N,
+		typename Compare, typename Allocator>
+bool    operator==(const ft::small_map<Key, Value, N, Compare, Allocator> &f,
+				   const ft::small_map<Key, Value, N, Compare, Allocator> &s)
+{
+	return equal(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template <typename Key, typename Value, size_t N,
+		typename Compare, typename Allocator>
+bool    operator!=(const ft::small_map<Key, Value, N, Compare, Allocator> &f,
+				   const ft::small_map<Key, Value, N, Compare, Allocator> &s)
+{
+	return !(f == s);
+}
+
+template <typename Key, typename Value, size_t N,
+		typename Compare, typename Allocator>
+bool    operator<(const ft::small_map<Key, Value, N, Compare, Allocator> &f,
+				  const ft::small_map<Key, Value, N, Compare, Allocator> &s)
+{
+	return ft::lexicographical_compare(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template <typename Key, typename Value, size_t N,
+		typename Compare, typename Allocator>
+bool    operator<=(const ft::small_map<Key, Value, N, Compare, Allocator> &f,
+				   const ft::small_map<Key, Value, N, Compare, Allocator> &s)
+{
+	return (f < s) || (f == s);
+}
+
+template <typename Key, typename Value, size_t N,
+		typename Compare, typename Allocator>
+bool    operator>(const ft::small_map<Key, Value, N, Compare, Allocator> &f,
+				  const ft::small_map<Key, Value, N, Compare, Allocator> &s)
+{
+	return !(f < s) && (f != s);
+}
+
+template <typename Key, typename Value, size_t N,
+		typename Compare, typename Allocator>
+bool    operator>=(const ft::small_map<Key, Value, N, Compare, Allocator> &f,
+				   const ft::small_map<Key, Value, N, Compare, Allocator> &s)
+{
+	return (f > s) || (f == s);
+}
+}
+#endif //FT_CONTAINERS_FINAL_SMALL_MAP_HPP
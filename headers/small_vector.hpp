@@ -0,0 +1,472 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_SMALL_VECTOR_HPP
+#define FT_CONTAINERS_FINAL_SMALL_VECTOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <cstdio>
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+namespace ft {
+//ft::small_vector: ft::vector which keeps up to N elements inside the object
+//and only goes to the allocator once it grows past N. Iterators are the
+//ft::vector<T, Allocator> ones.
+template<typename T, size_t N = 16, typename Allocator = std::allocator<T> >
+class small_vector {
+public:
+	typedef T value_type;
+	typedef Allocator allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef typename allocator_type::size_type size_type;
+
+	typedef typename vector<T, Allocator>::iterator iterator;
+	typedef typename vector<T, Allocator>::const_iterator const_iterator;
+	typedef common_reverse_iterator<iterator> reverse_iterator;
+	typedef common_reverse_iterator<const_iterator> const_reverse_iterator;
+
+
+private:
+	union storage_t {
+		char buf[N * sizeof(value_type)];
+		long double align_ld;
+		long long align_ll;
+		void *align_ptr;
+	};
+
+	storage_t storage;
+	value_type *arr;
+	size_type len;
+	size_type cap;
+	allocator_type alloc;
+
+private:
+	//Utils:
+	value_type *items(void) { return reinterpret_cast<value_type *>(storage.buf); }
+
+	void uptocap(size_type newcap);
+
+	void destroy(void);
+
+	void release(void);
+
+	//Makes room for n elements at index pos, the gap is left unconstructed.
+	void open_gap(size_type pos, size_type n);
+
+public:
+	small_vector(const allocator_type &_alloc = allocator_type())
+			: arr(items()), len(0), cap(N), alloc(_alloc) {}
+
+	small_vector(const size_type n, const value_type &val = value_type(),
+				 const allocator_type &_alloc = allocator_type())
+			: arr(items()), len(0), cap(N), alloc(_alloc) { assign(n, val); }
+
+	template<class InputIterator>
+	small_vector(InputIterator first,
+				 typename IsInputIter<InputIterator>::type last,
+				 const allocator_type &_alloc = allocator_type())
+			: arr(items()), len(0), cap(N), alloc(_alloc) { assign(first, last); }
+
+	small_vector(const small_vector &inst)
+			: arr(items()), len(0), cap(N), alloc(inst.alloc) { *this = inst; }
+
+	~small_vector(void) { clear(); }
+
+	small_vector &operator=(const small_vector &inst);
+
+	//Iterators:
+	iterator begin(void) { return iterator(arr); }
+
+	const_iterator begin(void) const { return const_iterator(arr); }
+
+	iterator end(void) { return iterator(arr + len); }
+
+	const_iterator end(void) const { return const_iterator(arr + len); }
+
+	reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin(void) const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend(void) { return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend(void) const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin(void) const { return begin(); }
+
+	const_iterator cend(void) const { return end(); }
+
+	const_reverse_iterator crbegin(void) const { return rbegin(); }
+
+	const_reverse_iterator crend(void) const { return rend(); }
+
+	//Element access:
+	reference operator[](const size_type i) { return arr[i]; }
+
+	const_reference operator[](const size_type i) const { return arr[i]; }
+
+	reference at(const size_type n);
+
+	const_reference at(const size_type n) const;
+
+	reference front(void) { return *arr; }
+
+	const_reference front(void) const { return *arr; }
+
+	reference back(void) { return arr[len - 1]; }
+
+	const_reference back(void) const { return arr[len - 1]; }
+
+	value_type *data(void) { return arr; }
+
+	const value_type *data(void) const { return arr; }
+
+	//Capacity:
+	size_type size(void) const { return len; }
+
+	size_type max_size(void) const { return alloc.max_size(); }
+
+	void resize(const size_type n, const value_type &val = value_type());
+
+	size_type capacity(void) const { return cap; }
+
+	bool empty(void) const { return len == 0; }
+
+	bool is_inline(void) const {
+		return arr == reinterpret_cast<const value_type *>(storage.buf);
+	}
+
+	static size_type inline_capacity(void) { return N; }
+
+	void reserve(const size_type n) {
+		if (n <= cap) return;
+		uptocap(n);
+	}
+
+	void shrink_to_fit(void) {
+		if (len == cap || is_inline()) return;
+		uptocap(len);
+	}
+
+	//Modifiers:
+	template<typename InputIterator>
+	typename IsInputIter<InputIterator, ft::setVoid>::type
+	assign(InputIterator first, InputIterator last);
+
+	void assign(const size_type n, const value_type &val);
+
+	void push_back(const value_type &value);
+
+	void pop_back(void) { if (len) alloc.destroy(&arr[--len]); }
+
+	iterator insert(iterator position, const value_type &val);
+
+	void insert(iterator position, size_t n, const value_type &val);
+
+	template<typename InputIterator>
+	void insert(iterator position, InputIterator first,
+				typename IsInputIter<InputIterator>::type last);
+
+	iterator erase(iterator position);
+
+	iterator erase(iterator first, iterator last);
+
+	allocator_type get_allocator(void) const { return alloc; }
+
+	void swap(small_vector &x);
+
+	void clear(void);
+
+};
+
+//Compaire operators:
+template<typename T, size_t N, typename Allocator>
+bool operator==(const small_vector<T, N, Allocator> &f,
+				const small_vector<T, N, Allocator> &s) {
+	return equal(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T, size_t N, typename Allocator>
+bool operator!=(const small_vector<T, N, Allocator> &f,
+				const small_vector<T, N, Allocator> &s) {
+	return !(f == s);
+}
+
+template<typename T, size_t N, typename Allocator>
+bool operator<(const small_vector<T, N, Allocator> &f,
+			   const small_vector<T, N, Allocator> &s) {
+	return ft::lexicographical_compare(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T, size_t N, typename Allocator>
+bool operator<=(const small_vector<T, N, Allocator> &f,
+				const small_vector<T, N, Allocator> &s) {
+	return (f < s) || (f == s);
+}
+
+template<typename T, size_t N, typename Allocator>
+bool operator>(const small_vector<T, N, Allocator> &f,
+			   const small_vector<T, N, Allocator> &s) {
+	return !(f < s) && (f != s);
+}
+
+template<typename T, size_t N, typename Allocator>
+bool operator>=(const small_vector<T, N, Allocator> &f,
+				const small_vector<T, N, Allocator> &s) {
+	return (f > s) || (f == s);
+}
+
+//std::swap:
+template<typename T, size_t N, typename Allocator>
+void swap(small_vector<T, N, Allocator> &f, small_vector<T, N, Allocator> &s) {
+	f.swap(s);
+}
+
+template<typename T, size_t N, typename Allocator>
+ft::small_vector<T, N, Allocator> &ft::small_vector<T, N, Allocator>::operator=(
+		const small_vector &inst) {
+	if (this == &inst)
+		return (*this);
+	destroy();
+	reserve(inst.len);
+	for (size_t i = 0; i < inst.len; i++) {
+		alloc.construct(&arr[i], inst.arr[i]);
+		len++;
+	}
+	return (*this);
+}
+
+//Utils:
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::uptocap(size_type newcap) {
+	value_type *tmp;
+	bool to_inline = newcap <= N;
+
+	if (newcap < len)
+		newcap = len;
+	if (to_inline) {
+		if (is_inline())
+			return;
+		newcap = N;
+		tmp = items();
+	} else {
+		tmp = alloc.allocate(newcap);
+	}
+	for (size_t i = 0; i < len; i++) {
+		try {
+			alloc.construct(&tmp[i], arr[i]);
+		}
+		catch (...) {
+			for (size_t j = 0; j < i; j++)
+				alloc.destroy(&tmp[j]);
+			if (!to_inline)
+				alloc.deallocate(tmp, newcap);
+			throw;
+		}
+	}
+	for (size_t i = 0; i < len; i++)
+		alloc.destroy(&arr[i]);
+	release();
+	cap = newcap;
+	arr = tmp;
+}
+
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::destroy(void) {
+	for (size_t i = 0; i < len; i++)
+		alloc.destroy(&arr[i]);
+	len = 0;
+}
+
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::release(void) {
+	if (!is_inline())
+		alloc.deallocate(arr, cap);
+	arr = items();
+	cap = N;
+}
+
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::open_gap(size_type pos, size_type n) {
+	if (len + n > cap)
+		uptocap(len + n > cap * 2 ? len + n : cap * 2);
+	for (size_t i = len; i > pos; i--) {
+		alloc.construct(&arr[i - 1 + n], arr[i - 1]);
+		alloc.destroy(&arr[i - 1]);
+	}
+}
+
+//Element acsses:
+template<typename T, size_t N, typename Allocator>
+typename ft::small_vector<T, N, Allocator>::reference
+ft::small_vector<T, N, Allocator>::at(const size_type n) {
+	if (n < len)
+		return arr[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+template<typename T, size_t N, typename Allocator>
+typename ft::small_vector<T, N, Allocator>::const_reference
+ft::small_vector<T, N, Allocator>::at(const size_type n) const {
+	if (n < len)
+		return arr[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+//Capacity:
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::resize(
+		const size_type n, const value_type &val) {
+	if (n < len) {
+		while (len != n)
+			pop_back();
+		return;
+	}
+	if (n > len)
+		insert(end(), n - len, val);
+}
+
+//Modifiers:
+template<typename T, size_t N, typename Allocator>
+template<typename InputIterator>
+typename ft::IsInputIter<InputIterator, ft::setVoid>::type
+ft::small_vector<T, N, Allocator>::assign(
+		InputIterator first, InputIterator last) {
+	destroy();
+	while (first != last)
+		push_back(*first++);
+}
+
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::assign(
+		const size_type n, const value_type &val) {
+	destroy();
+	reserve(n);
+	while (len != n)
+		alloc.construct(&arr[len++], val);
+}
+
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::push_back(const value_type &value) {
+	if (len == cap) {
+		value_type tmp(value);
+		uptocap(cap * 2);
+		alloc.construct(&arr[len++], tmp);
+		return;
+	}
+	alloc.construct(&arr[len], value);
+	len++;
+}
+
+template<typename T, size_t N, typename Allocator>
+typename ft::small_vector<T, N, Allocator>::iterator
+ft::small_vector<T, N, Allocator>::insert(
+		iterator position, const value_type &val) {
+	size_t pos = position.base() - arr;
+
+	insert(position, 1, val);
+	return begin() + pos;
+}
+
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::insert(
+		iterator position, size_t n, const value_type &val) {
+	size_t pos = position.base() - arr;
+	value_type tmp(val);
+
+	if (n == 0)
+		return;
+	open_gap(pos, n);
+	for (size_t i = 0; i < n; i++)
+		alloc.construct(&arr[pos + i], tmp);
+	len += n;
+}
+
+template<typename T, size_t N, typename Allocator>
+template<typename InputIterator>
+void ft::small_vector<T, N, Allocator>::insert(
+		iterator position, InputIterator first,
+		typename IsInputIter<InputIterator>::type last) {
+	size_t pos = position.base() - arr;
+	size_t n = ft::distance(first, last);
+
+	if (n == 0)
+		return;
+	open_gap(pos, n);
+	for (size_t i = 0; i < n; i++)
+		alloc.construct(&arr[pos + i], *first++);
+	len += n;
+}
+
+template<typename T, size_t N, typename Allocator>
+typename ft::small_vector<T, N, Allocator>::iterator
+ft::small_vector<T, N, Allocator>::erase(iterator position) {
+	return erase(position, position + 1);
+}
+
+template<typename T, size_t N, typename Allocator>
+typename ft::small_vector<T, N, Allocator>::iterator
+ft::small_vector<T, N, Allocator>::erase(iterator first, iterator last) {
+	size_t pos = first.base() - arr;
+	size_t n = last.base() - first.base();
+
+	if (n == 0)
+		return first;
+	for (size_t i = pos; i < pos + n; i++)
+		alloc.destroy(&arr[i]);
+	for (size_t i = pos + n; i < len; i++) {
+		alloc.construct(&arr[i - n], arr[i]);
+		alloc.destroy(&arr[i]);
+	}
+	len -= n;
+	return begin() + pos;
+}
+
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::clear(void) {
+	destroy();
+	release();
+}
+
+template<typename T, size_t N, typename Allocator>
+void ft::small_vector<T, N, Allocator>::swap(small_vector &x) {
+	if (this == &x)
+		return;
+	if (is_inline() || x.is_inline()) {
+		small_vector tmp(x);
+		x = *this;
+		*this = tmp;
+		return;
+	}
+
+	value_type *xarr = x.arr;
+	size_type xlen = x.len;
+	size_type xcap = x.cap;
+
+	x.arr = arr;
+	x.len = len;
+	x.cap = cap;
+
+	arr = xarr;
+	len = xlen;
+	cap = xcap;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_SMALL_VECTOR_HPP
@@ -0,0 +1,411 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_SOA_VECTOR_HPP
+#define FT_CONTAINERS_FINAL_SOA_VECTOR_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <cstdio>
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+namespace ft {
+//Fills the unused columns of a soa_vector.
+struct soa_none {};
+
+//ft::soa_element: type of field N of a soa_row.
+template<int N, typename Row>
+struct soa_element;
+
+template<typename Row>
+struct soa_element<0, Row> {typedef typename Row::first_type type;};
+
+template<typename Row>
+struct soa_element<1, Row> {typedef typename Row::second_type type;};
+
+template<typename Row>
+struct soa_element<2, Row> {typedef typename Row::third_type type;};
+
+template<typename Row>
+struct soa_element<3, Row> {typedef typename Row::fourth_type type;};
+
+//ft::soa_row: one row of a soa_vector, laid out like a struct.
+template<typename T1, typename T2 = soa_none, typename T3 = soa_none,
+		typename T4 = soa_none>
+struct soa_row {
+	typedef T1 first_type;
+	typedef T2 second_type;
+	typedef T3 third_type;
+	typedef T4 fourth_type;
+
+	T1 first;
+	T2 second;
+	T3 third;
+	T4 fourth;
+
+	soa_row(void): first(), second(), third(), fourth() {}
+
+	soa_row(const T1 &a, const T2 &b = T2(), const T3 &c = T3(),
+			const T4 &d = T4()): first(a), second(b), third(c), fourth(d) {}
+
+	//get<N>(): field N, counted from 0.
+	template<int N>
+	typename soa_element<N, soa_row>::type &get(void);
+
+	template<int N>
+	const typename soa_element<N, soa_row>::type &get(void) const;
+};
+
+//ft::span: a pointer and a length, begin() and end() are raw pointers so
+//loops over them vectorize.
+template<typename T>
+struct span {
+	typedef T value_type;
+	typedef T *iterator;
+	typedef size_t size_type;
+
+private:
+	T *ptr;
+	size_type len;
+
+public:
+	span(void): ptr(NULL), len(0) {}
+
+	span(T *_ptr, size_type _len): ptr(_ptr), len(_len) {}
+
+	//span<T> to span<const T>.
+	template<typename U>
+	span(const span<U> &inst): ptr(inst.data()), len(inst.size()) {}
+
+	iterator begin(void) const { return ptr; }
+
+	iterator end(void) const { return ptr + len; }
+
+	T *data(void) const { return ptr; }
+
+	size_type size(void) const { return len; }
+
+	bool empty(void) const { return len == 0; }
+
+	T &operator[](size_type i) const { return ptr[i]; }
+};
+
+//ft::soa_column: storage of one column, nothing at all for soa_none.
+template<typename T>
+struct soa_column : public vector<T> {
+	bool equal_to(const soa_column &x) const {
+		return this->size() == x.size()
+			   && ft::equal(this->begin(), this->end(), x.begin(), x.end());
+	}
+};
+
+template<>
+struct soa_column<soa_none> {
+	soa_none operator[](size_t) const { return soa_none(); }
+
+	soa_none *data(void) const { return NULL; }
+
+	void push_back(const soa_none &) {}
+
+	void pop_back(void) {}
+
+	void reserve(size_t) {}
+
+	void resize(size_t, const soa_none &) {}
+
+	void clear(void) {}
+
+	void swap(soa_column &) {}
+
+	bool equal_to(const soa_column &) const { return true; }
+};
+
+//ft::soa_get: field and column N, for soa_row::get and soa_vector.
+template<int N>
+struct soa_get;
+
+template<>
+struct soa_get<0> {
+	template<typename R>
+	static typename R::first_type &row(R &r) { return r.first; }
+
+	template<typename V>
+	static soa_column<typename V::value_type::first_type> &column(V &v) {
+		return v.c1;
+	}
+};
+
+template<>
+struct soa_get<1> {
+	template<typename R>
+	static typename R::second_type &row(R &r) { return r.second; }
+
+	template<typename V>
+	static soa_column<typename V::value_type::second_type> &column(V &v) {
+		return v.c2;
+	}
+};
+
+template<>
+struct soa_get<2> {
+	template<typename R>
+	static typename R::third_type &row(R &r) { return r.third; }
+
+	template<typename V>
+	static soa_column<typename V::value_type::third_type> &column(V &v) {
+		return v.c3;
+	}
+};
+
+template<>
+struct soa_get<3> {
+	template<typename R>
+	static typename R::fourth_type &row(R &r) { return r.fourth; }
+
+	template<typename V>
+	static soa_column<typename V::value_type::fourth_type> &column(V &v) {
+		return v.c4;
+	}
+};
+
+template<typename T1, typename T2, typename T3, typename T4>
+template<int N>
+typename soa_element<N, soa_row<T1, T2, T3, T4> >::type &
+soa_row<T1, T2, T3, T4>::get(void) {
+	return soa_get<N>::row(*this);
+}
+
+template<typename T1, typename T2, typename T3, typename T4>
+template<int N>
+const typename soa_element<N, soa_row<T1, T2, T3, T4> >::type &
+soa_row<T1, T2, T3, T4>::get(void) const {
+	return soa_get<N>::row(const_cast<soa_row &>(*this));
+}
+
+//ft::soa_vector: a vector of rows of up to four fields, stored as one
+//contiguous array per field. A scan over one field only pulls that field
+//through the cache: column<N>() gives it as a ft::span.
+//operator[] returns a proxy: v[i].get<N>() is field N of row i, and the
+//proxy converts to and can be assigned from a soa_row.
+template<typename T1, typename T2 = soa_none, typename T3 = soa_none,
+		typename T4 = soa_none>
+class soa_vector {
+	template<bool IsConst>
+	struct common_reference;
+
+	template<int N>
+	friend struct soa_get;
+
+public:
+	typedef soa_row<T1, T2, T3, T4> value_type;
+	typedef size_t size_type;
+
+	typedef soa_vector::common_reference<NotConst> reference;
+	typedef soa_vector::common_reference<Const> const_reference;
+
+
+private:
+	soa_column<T1> c1;
+	soa_column<T2> c2;
+	soa_column<T3> c3;
+	soa_column<T4> c4;
+
+public:
+	soa_vector(void) {}
+
+	soa_vector(const size_type n, const value_type &val = value_type()) {
+		resize(n, val);
+	}
+
+	//Element access:
+	reference operator[](const size_type i) { return reference(this, i); }
+
+	const_reference operator[](const size_type i) const {
+		return const_reference(this, i);
+	}
+
+	reference at(const size_type n);
+
+	const_reference at(const size_type n) const;
+
+	reference front(void) { return reference(this, 0); }
+
+	const_reference front(void) const { return const_reference(this, 0); }
+
+	reference back(void) { return reference(this, size() - 1); }
+
+	const_reference back(void) const {
+		return const_reference(this, size() - 1);
+	}
+
+	//Field N of every row.
+	template<int N>
+	span<typename soa_element<N, value_type>::type> column(void) {
+		return span<typename soa_element<N, value_type>::type>(
+				soa_get<N>::column(*this).data(), size());
+	}
+
+	template<int N>
+	span<const typename soa_element<N, value_type>::type> column(void) const {
+		return span<const typename soa_element<N, value_type>::type>(
+				soa_get<N>::column(const_cast<soa_vector &>(*this)).data(),
+				size());
+	}
+
+	//Capacity:
+	size_type size(void) const { return c1.size(); }
+
+	size_type max_size(void) const { return c1.max_size(); }
+
+	size_type capacity(void) const { return c1.capacity(); }
+
+	bool empty(void) const { return c1.empty(); }
+
+	void reserve(const size_type n) {
+		c1.reserve(n);
+		c2.reserve(n);
+		c3.reserve(n);
+		c4.reserve(n);
+	}
+
+	void resize(const size_type n, const value_type &val = value_type()) {
+		c1.resize(n, val.first);
+		c2.resize(n, val.second);
+		c3.resize(n, val.third);
+		c4.resize(n, val.fourth);
+	}
+
+	//Modifiers:
+	void push_back(const value_type &val) {
+		c1.push_back(val.first);
+		c2.push_back(val.second);
+		c3.push_back(val.third);
+		c4.push_back(val.fourth);
+	}
+
+	void push_back(const T1 &a, const T2 &b, const T3 &c = T3(),
+				   const T4 &d = T4()) {
+		c1.push_back(a);
+		c2.push_back(b);
+		c3.push_back(c);
+		c4.push_back(d);
+	}
+
+	void pop_back(void) {
+		if (empty())
+			return;
+		c1.pop_back();
+		c2.pop_back();
+		c3.pop_back();
+		c4.pop_back();
+	}
+
+	void swap(soa_vector &x) {
+		c1.swap(x.c1);
+		c2.swap(x.c2);
+		c3.swap(x.c3);
+		c4.swap(x.c4);
+	}
+
+	void clear(void) {
+		c1.clear();
+		c2.clear();
+		c3.clear();
+		c4.clear();
+	}
+
+	bool equal_to(const soa_vector &x) const {
+		return c1.equal_to(x.c1) && c2.equal_to(x.c2) && c3.equal_to(x.c3)
+			   && c4.equal_to(x.c4);
+	}
+
+};
+
+//Compaire operators:
+template<typename T1, typename T2, typename T3, typename T4>
+bool operator==(const soa_vector<T1, T2, T3, T4> &f,
+				const soa_vector<T1, T2, T3, T4> &s) {
+	return f.equal_to(s);
+}
+
+template<typename T1, typename T2, typename T3, typename T4>
+bool operator!=(const soa_vector<T1, T2, T3, T4> &f,
+				const soa_vector<T1, T2, T3, T4> &s) {
+	return !(f == s);
+}
+
+//std::swap:
+template<typename T1, typename T2, typename T3, typename T4>
+void swap(soa_vector<T1, T2, T3, T4> &f, soa_vector<T1, T2, T3, T4> &s) {
+	f.swap(s);
+}
+
+//Element acsses:
+template<typename T1, typename T2, typename T3, typename T4>
+typename ft::soa_vector<T1, T2, T3, T4>::reference
+ft::soa_vector<T1, T2, T3, T4>::at(const size_type n) {
+	if (n < size())
+		return reference(this, n);
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, size());
+	throw std::out_of_range(err);
+}
+
+template<typename T1, typename T2, typename T3, typename T4>
+typename ft::soa_vector<T1, T2, T3, T4>::const_reference
+ft::soa_vector<T1, T2, T3, T4>::at(const size_type n) const {
+	if (n < size())
+		return const_reference(this, n);
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, size());
+	throw std::out_of_range(err);
+}
+
+//Row proxy returned by operator[].
+template<typename T1, typename T2, typename T3, typename T4>
+template<bool IsConst>
+struct ft::soa_vector<T1, T2, T3, T4>::common_reference {
+private:
+	soa_vector *vec;
+	size_type pos;
+
+public:
+	common_reference(const soa_vector *_vec, size_type _pos)
+			: vec(const_cast<soa_vector *>(_vec)), pos(_pos) {}
+
+	template<int N>
+	typename conditional<IsConst,
+			typename soa_element<N, value_type>::type,
+			const typename soa_element<N, value_type>::type>::type &
+	get(void) const { return soa_get<N>::column(*vec)[pos]; }
+
+	operator value_type(void) const {
+		return value_type(vec->c1[pos], vec->c2[pos], vec->c3[pos],
+						  vec->c4[pos]);
+	}
+
+	const common_reference &operator=(const value_type &val) const {
+		vec->c1[pos] = val.first;
+		set(vec->c2, val.second);
+		set(vec->c3, val.third);
+		set(vec->c4, val.fourth);
+		return *this;
+	}
+
+	const common_reference &operator=(const common_reference &x) const {
+		return *this = static_cast<value_type>(x);
+	}
+
+private:
+	template<typename T>
+	void set(soa_column<T> &c, const T &val) const { c[pos] = val; }
+
+	void set(soa_column<soa_none> &, const soa_none &) const {}
+};
+}
+
+#endif //FT_CONTAINERS_FINAL_SOA_VECTOR_HPP
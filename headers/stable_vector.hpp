@@ -0,0 +1,555 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_STABLE_VECTOR_HPP
+#define FT_CONTAINERS_FINAL_STABLE_VECTOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <cstdio>
+#include <sys/mman.h>
+#include <unistd.h>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+namespace ft {
+//Upper bound on the elements of a stable_vector: the address range for
+//that many is reserved up front. 0 picks 4 GB worth of elements.
+struct max_capacity {
+	size_t n;
+
+	explicit max_capacity(size_t _n = 0): n(_n) {}
+};
+
+//ft::stable_vector: a vector that never moves its elements. The whole
+//address range for max_size() elements is reserved with a PROT_NONE
+//mmap(2) and pages are committed with mprotect(2) as it grows, so growth
+//never copies and pointers and iterators stay valid across push_back,
+//reserve and resize. insert and erase still shift the elements after
+//their position, which invalidates pointers there as in ft::vector.
+//Reserved but uncommitted address space costs no memory.
+//Growing past max_size() throws std::length_error.
+//Iterators are the ft::vector<T> ones.
+template<typename T>
+class stable_vector {
+public:
+	typedef T value_type;
+	typedef T &reference;
+	typedef const T &const_reference;
+	typedef T *pointer;
+	typedef const T *const_pointer;
+	typedef size_t size_type;
+
+	typedef typename vector<T>::iterator iterator;
+	typedef typename vector<T>::const_iterator const_iterator;
+	typedef common_reverse_iterator<iterator> reverse_iterator;
+	typedef common_reverse_iterator<const_iterator> const_reverse_iterator;
+
+
+private:
+	value_type *arr;
+	size_type len;
+	//Committed elements.
+	size_type cap;
+	//Reserved elements.
+	size_type maxcap;
+
+private:
+	//Utils:
+	static size_type page_size(void) {
+		static const size_type page = sysconf(_SC_PAGESIZE);
+
+		return page;
+	}
+
+	//Bytes of address space reserved for maxcap elements.
+	size_type reserved_bytes(void) const {
+		return (maxcap * sizeof(T) + page_size() - 1) & ~(page_size() - 1);
+	}
+
+	//Commits at least n elements, geometrically and 64 KB at a time.
+	void uptocap(size_type n);
+
+	void grow_to(size_type n) {
+		if (n > cap)
+			uptocap(n);
+	}
+
+	//Moves the element at src to the raw slot dst.
+	static void relocate(value_type *dst, value_type *src);
+
+	void destroy(void);
+
+	//Opens a gap of n raw slots at i.
+	void open_gap(size_type i, size_type n);
+
+public:
+	stable_vector(const ft::max_capacity &lim = ft::max_capacity());
+
+	stable_vector(const size_type n, const value_type &val = value_type(),
+				  const ft::max_capacity &lim = ft::max_capacity());
+
+	template<class InputIterator>
+	stable_vector(InputIterator first,
+				  typename IsInputIter<InputIterator>::type last,
+				  const ft::max_capacity &lim = ft::max_capacity());
+
+	stable_vector(const stable_vector &inst);
+
+	~stable_vector(void) { clear(); }
+
+	stable_vector &operator=(const stable_vector &inst);
+
+#if __cplusplus >= 201103L
+	stable_vector(stable_vector &&inst) noexcept
+			: arr(inst.arr), len(inst.len), cap(inst.cap),
+			  maxcap(inst.maxcap) {
+		inst.arr = NULL;
+		inst.len = 0;
+		inst.cap = 0;
+	}
+
+	stable_vector &operator=(stable_vector &&inst) noexcept {
+		clear();
+		swap(inst);
+		return *this;
+	}
+#endif
+
+	//Iterators:
+	iterator begin(void) { return iterator(arr); }
+
+	const_iterator begin(void) const { return const_iterator(arr); }
+
+	iterator end(void) { return iterator(arr + len); }
+
+	const_iterator end(void) const { return const_iterator(arr + len); }
+
+	reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin(void) const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend(void) { return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend(void) const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin(void) const { return begin(); }
+
+	const_iterator cend(void) const { return end(); }
+
+	const_reverse_iterator crbegin(void) const { return rbegin(); }
+
+	const_reverse_iterator crend(void) const { return rend(); }
+
+	//Element access:
+	reference operator[](const size_type i) { return arr[i]; }
+
+	const_reference operator[](const size_type i) const { return arr[i]; }
+
+	reference at(const size_type n);
+
+	const_reference at(const size_type n) const;
+
+	reference front(void) { return *arr; }
+
+	const_reference front(void) const { return *arr; }
+
+	reference back(void) { return arr[len - 1]; }
+
+	const_reference back(void) const { return arr[len - 1]; }
+
+	value_type *data(void) { return arr; }
+
+	const value_type *data(void) const { return arr; }
+
+	//Capacity:
+	size_type size(void) const { return len; }
+
+	//The max_capacity the vector was built with.
+	size_type max_size(void) const { return maxcap; }
+
+	void resize(const size_type n, const value_type &val = value_type());
+
+	size_type capacity(void) const { return cap; }
+
+	bool empty(void) const { return len == 0; }
+
+	void reserve(const size_type n) { grow_to(n); }
+
+	//Gives the pages past size() back to the system, addresses stay put.
+	void shrink_to_fit(void);
+
+	//Modifiers:
+	template<typename InputIterator>
+	typename IsInputIter<InputIterator, ft::setVoid>::type
+	assign(InputIterator first, InputIterator last);
+
+	void assign(const size_type n, const value_type &val);
+
+	void push_back(const value_type &value) {
+		//No reallocation, so value may point into the vector.
+		if (len == cap)
+			uptocap(len + 1);
+		::new(static_cast<void *>(arr + len)) value_type(value);
+		len++;
+	}
+
+	void pop_back(void) { if (len) arr[--len].~value_type(); }
+
+	iterator insert(iterator position, const value_type &val);
+
+#if __cplusplus >= 201103L
+	void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+	template<typename... Args>
+	void emplace_back(Args &&... args) {
+		if (len == cap)
+			uptocap(len + 1);
+		::new(static_cast<void *>(arr + len))
+				value_type(std::forward<Args>(args)...);
+		len++;
+	}
+
+	template<typename... Args>
+	iterator emplace(const_iterator position, Args &&... args);
+
+	iterator insert(iterator position, value_type &&val) {
+		return emplace(position, std::move(val));
+	}
+#endif
+
+	void insert(iterator position, size_t n, const value_type &val);
+
+	template<typename InputIterator>
+	void insert(iterator position, InputIterator first,
+				typename IsInputIter<InputIterator>::type last);
+
+	iterator erase(iterator position);
+
+	iterator erase(iterator first, iterator last);
+
+	void swap(stable_vector &x);
+
+	//Destroys the elements and releases the address range.
+	void clear(void);
+
+};
+
+//Compaire operators:
+template<typename T>
+bool operator==(const stable_vector<T> &f, const stable_vector<T> &s) {
+	return equal(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T>
+bool operator!=(const stable_vector<T> &f, const stable_vector<T> &s) {
+	return !(f == s);
+}
+
+template<typename T>
+bool operator<(const stable_vector<T> &f, const stable_vector<T> &s) {
+	return ft::lexicographical_compare(f.begin(), f.end(), s.begin(), s.end());
+}
+
+template<typename T>
+bool operator<=(const stable_vector<T> &f, const stable_vector<T> &s) {
+	return (f < s) || (f == s);
+}
+
+template<typename T>
+bool operator>(const stable_vector<T> &f, const stable_vector<T> &s) {
+	return !(f < s) && (f != s);
+}
+
+template<typename T>
+bool operator>=(const stable_vector<T> &f, const stable_vector<T> &s) {
+	return (f > s) || (f == s);
+}
+
+//std::swap:
+template<typename T>
+void swap(stable_vector<T> &f, stable_vector<T> &s) { f.swap(s); }
+
+template<typename T>
+ft::stable_vector<T>::stable_vector(const ft::max_capacity &lim)
+		: arr(NULL), len(0), cap(0), maxcap(lim.n) {
+	if (maxcap == 0)
+		maxcap = (size_type(1) << (sizeof(void *) >= 8 ? 32 : 28)) / sizeof(T);
+}
+
+template<typename T>
+ft::stable_vector<T>::stable_vector(const size_type n, const value_type &val,
+									const ft::max_capacity &lim)
+		: arr(NULL), len(0), cap(0), maxcap(0) {
+	stable_vector tmp(lim);
+
+	tmp.insert(tmp.end(), n, val);
+	swap(tmp);
+}
+
+template<typename T>
+template<class InputIterator>
+ft::stable_vector<T>::stable_vector(
+		InputIterator first, typename IsInputIter<InputIterator>::type last,
+		const ft::max_capacity &lim)
+		: arr(NULL), len(0), cap(0), maxcap(0) {
+	stable_vector tmp(lim);
+
+	tmp.assign(first, last);
+	swap(tmp);
+}
+
+template<typename T>
+ft::stable_vector<T>::stable_vector(const stable_vector &inst)
+		: arr(NULL), len(0), cap(0), maxcap(inst.maxcap) {
+	*this = inst;
+}
+
+template<typename T>
+ft::stable_vector<T> &ft::stable_vector<T>::operator=(
+		const stable_vector &inst) {
+	if (this == &inst)
+		return (*this);
+	destroy();
+	grow_to(inst.len);
+	for (; len < inst.len; len++)
+		::new(static_cast<void *>(arr + len)) value_type(inst.arr[len]);
+	return (*this);
+}
+
+//Utils:
+template<typename T>
+void ft::stable_vector<T>::uptocap(size_type n) {
+	const size_type chunk = 64 * 1024;
+	size_type from;
+	size_type to;
+	void *p;
+
+	if (n > maxcap)
+		throw std::length_error("ft::stable_vector: max_capacity exceeded");
+	if (arr == NULL) {
+		p = mmap(NULL, reserved_bytes(), PROT_NONE,
+				 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (p == MAP_FAILED)
+			throw std::bad_alloc();
+		arr = static_cast<value_type *>(p);
+	}
+	from = (cap * sizeof(T) + page_size() - 1) & ~(page_size() - 1);
+	to = n > cap * 2 ? n : cap * 2;
+	to = (to * sizeof(T) + chunk - 1) & ~(chunk - 1);
+	if (to > reserved_bytes())
+		to = reserved_bytes();
+	if (mprotect(reinterpret_cast<char *>(arr) + from, to - from,
+				 PROT_READ | PROT_WRITE) != 0)
+		throw std::bad_alloc();
+	cap = to / sizeof(T);
+	if (cap > maxcap)
+		cap = maxcap;
+}
+
+template<typename T>
+void ft::stable_vector<T>::relocate(value_type *dst, value_type *src) {
+#if __cplusplus >= 201103L
+	::new(static_cast<void *>(dst)) value_type(std::move_if_noexcept(*src));
+#else
+	::new(static_cast<void *>(dst)) value_type(*src);
+#endif
+	src->~value_type();
+}
+
+template<typename T>
+void ft::stable_vector<T>::destroy(void) {
+	while (len)
+		arr[--len].~value_type();
+}
+
+template<typename T>
+void ft::stable_vector<T>::open_gap(size_type i, size_type n) {
+	grow_to(len + n);
+	for (size_type k = len; k > i; k--)
+		relocate(&arr[k - 1 + n], &arr[k - 1]);
+}
+
+//Element acsses:
+template<typename T>
+typename ft::stable_vector<T>::reference
+ft::stable_vector<T>::at(const size_type n) {
+	if (n < len)
+		return arr[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+template<typename T>
+typename ft::stable_vector<T>::const_reference
+ft::stable_vector<T>::at(const size_type n) const {
+	if (n < len)
+		return arr[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+//Capacity:
+template<typename T>
+void ft::stable_vector<T>::resize(const size_type n, const value_type &val) {
+	while (len > n)
+		pop_back();
+	grow_to(n);
+	for (; len < n; len++)
+		::new(static_cast<void *>(arr + len)) value_type(val);
+}
+
+template<typename T>
+void ft::stable_vector<T>::shrink_to_fit(void) {
+	size_type from;
+
+	if (arr == NULL)
+		return;
+	from = (len * sizeof(T) + page_size() - 1) & ~(page_size() - 1);
+	if (from >= cap * sizeof(T))
+		return;
+	madvise(reinterpret_cast<char *>(arr) + from, reserved_bytes() - from,
+			MADV_DONTNEED);
+	mprotect(reinterpret_cast<char *>(arr) + from, reserved_bytes() - from,
+			 PROT_NONE);
+	cap = from / sizeof(T);
+}
+
+//Modifiers:
+template<typename T>
+template<typename InputIterator>
+typename ft::IsInputIter<InputIterator, ft::setVoid>::type
+ft::stable_vector<T>::assign(InputIterator first, InputIterator last) {
+	destroy();
+	while (first != last)
+		push_back(*first++);
+}
+
+template<typename T>
+void ft::stable_vector<T>::assign(const size_type n, const value_type &val) {
+	destroy();
+	resize(n, val);
+}
+
+#if __cplusplus >= 201103L
+template<typename T>
+template<typename... Args>
+typename ft::stable_vector<T>::iterator
+ft::stable_vector<T>::emplace(const_iterator position, Args &&... args) {
+	size_type i = position.base() - arr;
+	value_type tmp(std::forward<Args>(args)...);
+
+	open_gap(i, 1);
+	::new(static_cast<void *>(arr + i)) value_type(std::move(tmp));
+	len++;
+	return begin() + i;
+}
+#endif
+
+template<typename T>
+typename ft::stable_vector<T>::iterator
+ft::stable_vector<T>::insert(iterator position, const value_type &val) {
+	size_t i = position.base() - arr;
+
+	insert(position, 1, val);
+	return begin() + i;
+}
+
+template<typename T>
+void ft::stable_vector<T>::insert(
+		iterator position, size_t n, const value_type &val) {
+	size_t i = position.base() - arr;
+	value_type tmp(val);
+
+	if (n == 0)
+		return;
+	open_gap(i, n);
+	for (size_t k = 0; k < n; k++)
+		::new(static_cast<void *>(arr + i + k)) value_type(tmp);
+	len += n;
+}
+
+template<typename T>
+template<typename InputIterator>
+void ft::stable_vector<T>::insert(
+		iterator position, InputIterator first,
+		typename IsInputIter<InputIterator>::type last) {
+	size_t i = position.base() - arr;
+	vector<value_type> tmp(first, last);
+	size_t n = tmp.size();
+
+	if (n == 0)
+		return;
+	open_gap(i, n);
+	for (size_t k = 0; k < n; k++)
+		::new(static_cast<void *>(arr + i + k)) value_type(tmp[k]);
+	len += n;
+}
+
+template<typename T>
+typename ft::stable_vector<T>::iterator
+ft::stable_vector<T>::erase(iterator position) {
+	return erase(position, position + 1);
+}
+
+template<typename T>
+typename ft::stable_vector<T>::iterator
+ft::stable_vector<T>::erase(iterator first, iterator last) {
+	size_t i = first.base() - arr;
+	size_t n = last.base() - first.base();
+
+	if (last.base() < first.base())
+		throw std::out_of_range("ft::stable_vector::erase: iterator out of range");
+	for (size_t k = i; k < i + n; k++)
+		arr[k].~value_type();
+	for (size_t k = i + n; k < len; k++)
+		relocate(&arr[k - n], &arr[k]);
+	len -= n;
+	return begin() + i;
+}
+
+template<typename T>
+void ft::stable_vector<T>::swap(stable_vector &x) {
+	if (this == &x)
+		return;
+
+	value_type *xarr = x.arr;
+	size_type xlen = x.len;
+	size_type xcap = x.cap;
+	size_type xmaxcap = x.maxcap;
+
+	x.arr = arr;
+	x.len = len;
+	x.cap = cap;
+	x.maxcap = maxcap;
+
+	arr = xarr;
+	len = xlen;
+	cap = xcap;
+	maxcap = xmaxcap;
+}
+
+template<typename T>
+void ft::stable_vector<T>::clear(void) {
+	destroy();
+	if (arr)
+		munmap(arr, reserved_bytes());
+	arr = NULL;
+	cap = 0;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_STABLE_VECTOR_HPP
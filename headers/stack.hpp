@@ -5,10 +5,14 @@
 #ifndef FT_CONTAINERS_FINAL_STACK_HPP
 #define FT_CONTAINERS_FINAL_STACK_HPP
 
-#include "vector.hpp"
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+#include "deque.hpp"
 
 namespace ft {
-template<typename T, typename Container = ft::vector<T> >
+template<typename T, typename Container = ft::deque<T> >
 class stack {
 public:
 	typedef T								value_type;
@@ -30,6 +34,21 @@ public:
 		return (*this);
 	}
 
+#if __cplusplus >= 201103L
+	stack(container_type &&cnt): c(std::move(cnt)) {}
+	stack(stack &&inst): c(std::move(inst.c)) {}
+
+	stack &operator=(stack &&inst) {
+		c = std::move(inst.c);
+		return (*this);
+	}
+
+	void	push(value_type &&val) {c.push_back(std::move(val));}
+
+	template<typename... Args>
+	void	emplace(Args &&... args) {c.emplace_back(std::forward<Args>(args)...);}
+#endif
+
 	bool				empty() const {return c.empty();}
 	size_type			size() const {return c.size();}
 	value_type			&top() { return c.back();}
@@ -6,6 +6,9 @@
 #define FT_CONTAINERS_FINAL_UTILS_HPP
 
 #include <typeinfo>
+#if __cplusplus >= 201103L
+# include <type_traits>
+#endif
 
 namespace ft
 {
@@ -36,6 +39,13 @@ struct is_same {static const bool value = false;};
 template<typename T>
 struct is_same<T, T> {static const bool value = true;};
 
+//ft::remove_const: T without a top-level const.
+template<typename T>
+struct remove_const {typedef T type;};
+
+template<typename T>
+struct remove_const<const T> {typedef T type;};
+
 template<typename T, typename U>
 bool    is_same_type(const T &f, const U &s)
 {
@@ -89,6 +99,41 @@ template <>
 struct is_integral<unsigned long long int>
 		: public _is_integral<true, unsigned long long int> {};
 
+//ft::is_trivially_default_constructible: T() does nothing but zero-fill,
+//so default-initialization may leave the memory as it is.
+template<typename T>
+struct is_trivially_default_constructible
+{
+#if __cplusplus >= 201103L
+	static const bool value = std::is_trivially_default_constructible<T>::value;
+#elif defined(__GNUC__)
+	static const bool value = __has_trivial_constructor(T);
+#else
+	static const bool value = is_integral<T>::value;
+#endif
+};
+
+//ft::is_trivially_copyable: T can be relocated with memcpy/mremap and
+//the old bytes dropped without running a destructor.
+template<typename T>
+struct is_trivially_copyable
+{
+#if __cplusplus >= 201103L
+	static const bool value = std::is_trivially_copyable<T>::value;
+#elif defined(__GNUC__)
+	static const bool value =
+			__has_trivial_copy(T) && __has_trivial_destructor(T);
+#else
+	static const bool value = is_integral<T>::value;
+#endif
+};
+
+//ft::has_reallocate: Allocator has reallocate(p, oldn, newn), which moves
+//a block of trivially copyable elements to a new size, keeping its bytes.
+//Allocators opt in by specializing it.
+template<typename Allocator>
+struct has_reallocate {static const bool value = false;};
+
 }
 
 #endif //FT_CONTAINERS_FINAL_UTILS_HPP
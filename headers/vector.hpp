@@ -7,8 +7,12 @@
 
 #include <cstddef>
 #include <memory>
+#include <new>
 #include <stdexcept>
 #include <cstdio>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
 
 #include "utils.hpp"
 #include "iterators.hpp"
@@ -17,6 +21,22 @@ namespace ft {
 const std::string OOR_MSG =
 		"vector::at: n (which is %lu) >= this->size() (which is %lu)";
 
+//ft::_reallocate: calls Allocator::reallocate only for allocators that have
+//one, so the other ones still compile.
+template<bool Reallocates>
+struct _reallocate {
+	template<typename Allocator, typename T>
+	static T *call(Allocator &, T *p, size_t, size_t) { return p; }
+};
+
+template<>
+struct _reallocate<true> {
+	template<typename Allocator, typename T>
+	static T *call(Allocator &alloc, T *p, size_t n, size_t newn) {
+		return alloc.reallocate(p, n, newn);
+	}
+};
+
 template<typename T, typename Allocator = std::allocator<T> >
 class vector {
 	template<bool IsConst>
@@ -49,6 +69,19 @@ private:
 
 	void destroy(void);
 
+	void grow_to(size_type n) {
+		if (n > cap)
+			uptocap(n > cap * 2 ? n : cap * 2);
+	}
+
+#if __cplusplus >= 201103L
+	template<typename... Args>
+	void construct(value_type *p, Args &&... args) {
+		std::allocator_traits<allocator_type>::construct(
+				alloc, p, std::forward<Args>(args)...);
+	}
+#endif
+
 public:
 	vector(const allocator_type &_alloc = allocator_type())
 			: arr(NULL), len(0), cap(0), alloc(_alloc) {}
@@ -68,6 +101,18 @@ public:
 
 	vector &operator=(const vector &inst);
 
+#if __cplusplus >= 201103L
+	vector(vector &&inst) noexcept
+			: arr(inst.arr), len(inst.len), cap(inst.cap),
+			  alloc(std::move(inst.alloc)) {
+		inst.arr = NULL;
+		inst.len = 0;
+		inst.cap = 0;
+	}
+
+	vector &operator=(vector &&inst) noexcept;
+#endif
+
 	//Iterators:
 	iterator begin(void);
 
@@ -110,12 +155,33 @@ public:
 
 	const_reference back(void) const { return arr[len - 1]; }
 
+	value_type *data(void) { return arr; }
+
+	const value_type *data(void) const { return arr; }
+
 	//Capacity:
 	size_type size(void) const { return len; }
 
 	size_type max_size(void) const { return alloc.max_size(); }
 
-	void resize(const size_type n, const value_type val = value_type());
+	void resize(const size_type n, const value_type &val = value_type());
+
+	void resize_default_init(const size_type n);
+
+	//Raw fill, for trivially constructible T only: prepare(n) returns room
+	//for n more elements past size(), commit(n) makes the first n of them
+	//part of the vector and throws std::length_error past capacity().
+	//See vector_io.hpp.
+	value_type *prepare(const size_type n) {
+		grow_to(len + n);
+		return arr + len;
+	}
+
+	void commit(const size_type n) {
+		if (n > cap - len)
+			throw std::length_error("ft::vector::commit: n is past capacity()");
+		len += n;
+	}
 
 	size_type capacity(void) const { return cap; }
 
@@ -144,6 +210,20 @@ public:
 
 	iterator insert(iterator position, const value_type &val);
 
+#if __cplusplus >= 201103L
+	void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+	template<typename... Args>
+	void emplace_back(Args &&... args);
+
+	template<typename... Args>
+	iterator emplace(const_iterator position, Args &&... args);
+
+	iterator insert(iterator position, value_type &&val) {
+		return emplace(position, std::move(val));
+	}
+#endif
+
 	void insert(iterator position, size_t n, const value_type &val);
 
 	template<typename InputIterator>
@@ -210,35 +290,85 @@ ft::vector<T, Allocator>::vector(
 		alloc.construct(&arr[i], val);
 }
 
+//Reuses the buffer when it is big enough: assigns over the live elements
+//and constructs or destroys only the difference. A new buffer is sized
+//to inst.size(), the slack capacity of inst is not copied.
 template<typename T, typename Allocator>
 ft::vector<T, Allocator> &ft::vector<T, Allocator>::operator=(
 		const vector &inst) {
+	value_type *tmp;
+	size_type i;
+	size_type n;
+
 	if (this == &inst)
 		return (*this);
-	clear();
-	len = inst.len;
-	cap = inst.cap;
-	if (cap) {
-		arr = alloc.allocate(cap);
-		for (size_t i = 0; i < len; i++) {
-			alloc.construct(&arr[i], inst.arr[i]);
+	if (inst.len > cap) {
+		tmp = alloc.allocate(inst.len);
+		for (i = 0; i < inst.len; i++) {
+			try {
+				alloc.construct(&tmp[i], inst.arr[i]);
+			}
+			catch (...) {
+				while (i)
+					alloc.destroy(&tmp[--i]);
+				alloc.deallocate(tmp, inst.len);
+				throw;
+			}
 		}
-	} else {
-		arr = NULL;
+		clear();
+		arr = tmp;
+		len = inst.len;
+		cap = inst.len;
+		return (*this);
 	}
+	n = len < inst.len ? len : inst.len;
+	for (i = 0; i < n; i++)
+		arr[i] = inst.arr[i];
+	for (; len < inst.len; len++)
+		alloc.construct(&arr[len], inst.arr[len]);
+	while (len > inst.len)
+		alloc.destroy(&arr[--len]);
 	return (*this);
 }
 
+#if __cplusplus >= 201103L
+template<typename T, typename Allocator>
+ft::vector<T, Allocator> &ft::vector<T, Allocator>::operator=(
+		vector &&inst) noexcept {
+	if (this == &inst)
+		return (*this);
+	clear();
+	swap(inst);
+	return (*this);
+}
+#endif
+
 //Utils:
 template<typename T, typename Allocator>
 void ft::vector<T, Allocator>::uptocap(
 		typename ft::vector<T, Allocator>::size_type newcap) {
 	ft::vector<T, Allocator>::value_type *tmp;
-
+	const bool relocate = has_reallocate<Allocator>::value
+						  && is_trivially_copyable<value_type>::value;
+
+	if (relocate && arr) {
+		//The allocator moves the bytes itself, e.g. with mremap.
+		arr = _reallocate<relocate>::call(alloc, arr, cap, newcap);
+		cap = newcap;
+		if (len > cap)
+			len = cap;
+		return;
+	}
 	tmp = alloc.allocate(newcap);
 	for (size_t i = 0; i < len && i < newcap; i++) {
 		try {
+#if __cplusplus >= 201103L
+			//Moves unless the move constructor may throw, then the old
+			//buffer has to stay intact for the catch below.
+			construct(&tmp[i], std::move_if_noexcept(arr[i]));
+#else
 			alloc.construct(&tmp[i], arr[i]);
+#endif
 		}
 		catch (...) {
 			for (size_t j = 0; j < i; j++)
@@ -288,16 +418,36 @@ void ft::vector<T, Allocator>::destroy(void) {
 //Capacity:
 template<typename T, typename Allocator>
 void ft::vector<T, Allocator>::resize(
-		const size_type n, const value_type val) {
-	if (n == len)
+		const size_type n, const value_type &val) {
+	while (len > n)
+		alloc.destroy(&arr[--len]);
+	if (len == n)
+		return;
+	if (n > cap) {
+		//val may live in arr, keep a copy across the reallocation.
+		value_type tmp(val);
+		grow_to(n);
+		for (; len < n; len++)
+			alloc.construct(&arr[len], tmp);
 		return;
-	if (n < len) {
-		while (len != n)
-			pop_back();
-	} else {
-		while (len != n)
-			push_back(val);
 	}
+	for (; len < n; len++)
+		alloc.construct(&arr[len], val);
+}
+
+//Like resize(n), but new elements are default-initialized: for trivially
+//default-constructible T they are left unset instead of being zero-filled.
+template<typename T, typename Allocator>
+void ft::vector<T, Allocator>::resize_default_init(const size_type n) {
+	while (len > n)
+		alloc.destroy(&arr[--len]);
+	grow_to(n);
+	if (is_trivially_default_constructible<value_type>::value) {
+		len = n;
+		return;
+	}
+	for (; len < n; len++)
+		new(&arr[len]) value_type;
 }
 
 //Modifiers:
@@ -320,17 +470,55 @@ void ft::vector<T, Allocator>::assign(
 
 template<typename T, typename Allocator>
 void ft::vector<T, Allocator>::push_back(const value_type &value) {
-	if (arr) {
-		if (len == cap)
-			uptocap(cap * 2);
-	} else {
+	if (!arr) {
 		cap = 2;
 		arr = alloc.allocate(cap);
+	} else if (len == cap) {
+		//value may live in arr, keep a copy across the reallocation.
+		value_type tmp(value);
+		uptocap(cap * 2);
+		alloc.construct(&arr[len], tmp);
+		len++;
+		return;
 	}
 	alloc.construct(&arr[len], value);
 	len++;
 }
 
+#if __cplusplus >= 201103L
+template<typename T, typename Allocator>
+template<typename... Args>
+void ft::vector<T, Allocator>::emplace_back(Args &&... args) {
+	if (len == cap) {
+		//args may point into arr, build the element before reallocating.
+		value_type tmp(std::forward<Args>(args)...);
+		uptocap(cap ? cap * 2 : 2);
+		construct(&arr[len], std::move(tmp));
+	} else {
+		construct(&arr[len], std::forward<Args>(args)...);
+	}
+	len++;
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename ft::vector<T, Allocator>::iterator
+ft::vector<T, Allocator>::emplace(const_iterator position, Args &&... args) {
+	size_type i = position.base() - arr;
+
+	if (i == len) {
+		emplace_back(std::forward<Args>(args)...);
+		return begin() + i;
+	}
+	value_type tmp(std::forward<Args>(args)...);
+	emplace_back(std::move(arr[len - 1]));
+	for (size_type k = len - 2; k > i; k--)
+		arr[k] = std::move(arr[k - 1]);
+	arr[i] = std::move(tmp);
+	return begin() + i;
+}
+#endif
+
 template<typename T, typename Allocator>
 typename ft::vector<T, Allocator>::iterator
 ft::vector<T, Allocator>::insert(iterator position, const value_type &val) {
@@ -668,6 +856,9 @@ struct ft::vector<T, Allocator>::common_iterator
 	typedef
 	typename conditional_t<IsConst, iterator, const_iterator>::type iter_t;
 
+	//ft::equal and ft::lexicographical_compare compare through base().
+	typedef value_t *contiguous_pointer;
+
 private:
 	value_t *item;
 
@@ -735,4 +926,6 @@ public:
 };
 }
 
+#include "vector_bool.hpp"
+
 #endif //FT_CONTAINERS_FINAL_VECTOR_HPP
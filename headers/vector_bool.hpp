@@ -0,0 +1,733 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_VECTOR_BOOL_HPP
+#define FT_CONTAINERS_FINAL_VECTOR_BOOL_HPP
+
+#include <cstddef>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <cstdio>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+#include "utils.hpp"
+#include "iterators.hpp"
+#include "vector.hpp"
+
+namespace ft {
+//ft::vector<bool>: one bit per element, packed into unsigned long words.
+//Bits past size() in the last word are always kept at zero, so count(),
+//find_first() and operator== can work a whole word at a time.
+template<typename Allocator>
+class vector<bool, Allocator> {
+	template<bool IsConst>
+	struct common_iterator;
+
+public:
+	typedef unsigned long word_type;
+
+	class reference;
+
+	typedef bool value_type;
+	typedef Allocator allocator_type;
+	typedef bool const_reference;
+	typedef size_t size_type;
+
+	typedef vector::common_iterator<NotConst> iterator;
+	typedef vector::common_iterator<Const> const_iterator;
+	typedef common_reverse_iterator<iterator> reverse_iterator;
+	typedef common_reverse_iterator<const_iterator> const_reverse_iterator;
+
+	static const size_type npos = static_cast<size_type>(-1);
+	static const size_type word_bits = sizeof(word_type) * CHAR_BIT;
+
+
+private:
+	typedef typename Allocator::template rebind<word_type>::other word_allocator;
+
+	word_type *arr;
+	size_type len;
+	size_type cap;
+	word_allocator alloc;
+
+	struct bit_and;
+	struct bit_or;
+	struct bit_xor;
+
+private:
+	//Utils:
+	static size_type nwords(size_type bits) {
+		return (bits + word_bits - 1) / word_bits;
+	}
+
+	static word_type mask(size_type i) {
+		return static_cast<word_type>(1) << (i % word_bits);
+	}
+
+	static size_type popcount(word_type w);
+
+	static size_type lowest_bit(word_type w);
+
+	bool get(size_type i) const { return (arr[i / word_bits] & mask(i)) != 0; }
+
+	void set(size_type i, bool val) {
+		if (val)
+			arr[i / word_bits] |= mask(i);
+		else
+			arr[i / word_bits] &= ~mask(i);
+	}
+
+	void uptocap(size_type newcap);
+
+	//Sets bits [first, last) to val, a word at a time where possible.
+	void fill(size_type first, size_type last, bool val);
+
+	//Moves bits [pos, len) to [pos + n, len + n), len grows by n.
+	void open_gap(size_type pos, size_type n);
+
+	template<typename Op>
+	void bitwise(const vector &x);
+
+public:
+	vector(const allocator_type &_alloc = allocator_type())
+			: arr(NULL), len(0), cap(0), alloc(_alloc) {}
+
+	vector(const size_type n, const value_type &val = value_type(),
+		   const allocator_type &_alloc = allocator_type())
+			: arr(NULL), len(0), cap(0), alloc(_alloc) { resize(n, val); }
+
+	template<class InputIterator>
+	vector(InputIterator first, typename IsInputIter<InputIterator>::type last,
+		   const allocator_type &_alloc = allocator_type())
+			: arr(NULL), len(0), cap(0), alloc(_alloc) { assign(first, last); }
+
+	vector(const vector &inst)
+			: arr(NULL), len(0), cap(0), alloc(word_allocator()) { *this = inst; }
+
+	~vector(void) { clear(); }
+
+	vector &operator=(const vector &inst);
+
+	//Iterators:
+	iterator begin(void) { return iterator(arr, 0); }
+
+	const_iterator begin(void) const { return const_iterator(arr, 0); }
+
+	iterator end(void) { return iterator(arr, len); }
+
+	const_iterator end(void) const { return const_iterator(arr, len); }
+
+	reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin(void) const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend(void) { return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend(void) const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin(void) const { return begin(); }
+
+	const_iterator cend(void) const { return end(); }
+
+	const_reverse_iterator crbegin(void) const { return rbegin(); }
+
+	const_reverse_iterator crend(void) const { return rend(); }
+
+	//Element access:
+	reference operator[](const size_type i) {
+		return reference(&arr[i / word_bits], mask(i));
+	}
+
+	const_reference operator[](const size_type i) const { return get(i); }
+
+	reference at(const size_type n);
+
+	const_reference at(const size_type n) const;
+
+	reference front(void) { return (*this)[0]; }
+
+	const_reference front(void) const { return get(0); }
+
+	reference back(void) { return (*this)[len - 1]; }
+
+	const_reference back(void) const { return get(len - 1); }
+
+	//Raw words, nwords(size()) of them, bits past size() are zero.
+	const word_type *words(void) const { return arr; }
+
+	size_type num_words(void) const { return nwords(len); }
+
+	//Capacity:
+	size_type size(void) const { return len; }
+
+	size_type max_size(void) const { return alloc.max_size(); }
+
+	void resize(const size_type n, const value_type val = value_type());
+
+	size_type capacity(void) const { return cap; }
+
+	bool empty(void) const { return len == 0; }
+
+	void reserve(const size_type n) {
+		if (n <= cap) return;
+		uptocap(n);
+	}
+
+	void shrink_to_fit(void) {
+		if (nwords(len) == nwords(cap)) return;
+		uptocap(len);
+	}
+
+	//Modifiers:
+	template<typename InputIterator>
+	typename IsInputIter<InputIterator, ft::setVoid>::type
+	assign(InputIterator first, InputIterator last);
+
+	void assign(const size_type n, const value_type &val);
+
+	void push_back(const value_type &value);
+
+	void pop_back(void) { if (len) set(--len, false); }
+
+	iterator insert(iterator position, const value_type &val);
+
+	void insert(iterator position, size_t n, const value_type &val);
+
+	template<typename InputIterator>
+	void insert(iterator position, InputIterator first,
+				typename IsInputIter<InputIterator>::type last);
+
+	iterator erase(iterator position);
+
+	iterator erase(iterator first, iterator last);
+
+	allocator_type get_allocator(void) const { return allocator_type(); }
+
+	void swap(vector &x);
+
+	static void swap(reference x, reference y) {
+		bool tmp = x;
+		x = y;
+		y = tmp;
+	}
+
+	void clear(void);
+
+	void flip(void);
+
+	//Bit operations:
+	size_type count(void) const;
+
+	size_type find_first(void) const { return find_from(0); }
+
+	size_type find_next(size_type pos) const { return find_from(pos + 1); }
+
+	size_type find_from(size_type pos) const;
+
+	//Both vectors must have the same size.
+	vector &operator&=(const vector &x) {
+		bitwise<bit_and>(x);
+		return *this;
+	}
+
+	vector &operator|=(const vector &x) {
+		bitwise<bit_or>(x);
+		return *this;
+	}
+
+	vector &operator^=(const vector &x) {
+		bitwise<bit_xor>(x);
+		return *this;
+	}
+
+};
+
+template<typename Allocator>
+class vector<bool, Allocator>::reference {
+	word_type *word;
+	word_type bit;
+
+public:
+	reference(word_type *_word, word_type _bit) : word(_word), bit(_bit) {}
+
+	~reference(void) {}
+
+	operator bool(void) const { return (*word & bit) != 0; }
+
+	reference &operator=(bool val) {
+		if (val)
+			*word |= bit;
+		else
+			*word &= ~bit;
+		return *this;
+	}
+
+	reference &operator=(const reference &inst) {
+		return *this = static_cast<bool>(inst);
+	}
+
+	bool operator==(const reference &rhs) const {
+		return static_cast<bool>(*this) == static_cast<bool>(rhs);
+	}
+
+	bool operator!=(const reference &rhs) const { return !(*this == rhs); }
+
+	bool operator<(const reference &rhs) const {
+		return !static_cast<bool>(*this) && static_cast<bool>(rhs);
+	}
+
+	bool operator~(void) const { return !static_cast<bool>(*this); }
+
+	void flip(void) { *word ^= bit; }
+};
+
+template<typename Allocator>
+struct vector<bool, Allocator>::bit_and {
+	static word_type apply(word_type a, word_type b) { return a & b; }
+#if defined(__SSE2__)
+	static __m128i apply(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+#endif
+};
+
+template<typename Allocator>
+struct vector<bool, Allocator>::bit_or {
+	static word_type apply(word_type a, word_type b) { return a | b; }
+#if defined(__SSE2__)
+	static __m128i apply(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+#endif
+};
+
+template<typename Allocator>
+struct vector<bool, Allocator>::bit_xor {
+	static word_type apply(word_type a, word_type b) { return a ^ b; }
+#if defined(__SSE2__)
+	static __m128i apply(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+#endif
+};
+
+//Compaire operators:
+template<typename Allocator>
+bool operator==(const vector<bool, Allocator> &f,
+				const vector<bool, Allocator> &s) {
+	if (f.size() != s.size())
+		return false;
+	return f.size() == 0 || std::memcmp(f.words(), s.words(),
+			f.num_words() * sizeof(*f.words())) == 0;
+}
+
+//Bit operations:
+template<typename Allocator>
+vector<bool, Allocator> operator&(const vector<bool, Allocator> &f,
+								  const vector<bool, Allocator> &s) {
+	vector<bool, Allocator> res(f);
+	return res &= s;
+}
+
+template<typename Allocator>
+vector<bool, Allocator> operator|(const vector<bool, Allocator> &f,
+								  const vector<bool, Allocator> &s) {
+	vector<bool, Allocator> res(f);
+	return res |= s;
+}
+
+template<typename Allocator>
+vector<bool, Allocator> operator^(const vector<bool, Allocator> &f,
+								  const vector<bool, Allocator> &s) {
+	vector<bool, Allocator> res(f);
+	return res ^= s;
+}
+
+template<typename Allocator>
+ft::vector<bool, Allocator> &ft::vector<bool, Allocator>::operator=(
+		const vector &inst) {
+	if (this == &inst)
+		return (*this);
+	clear();
+	if (inst.len) {
+		uptocap(inst.len);
+		std::memcpy(arr, inst.arr, nwords(inst.len) * sizeof(word_type));
+		len = inst.len;
+	}
+	return (*this);
+}
+
+//Utils:
+template<typename Allocator>
+typename ft::vector<bool, Allocator>::size_type
+ft::vector<bool, Allocator>::popcount(word_type w) {
+#if defined(__GNUC__)
+	return __builtin_popcountl(w);
+#else
+	size_type n = 0;
+	while (w) {
+		w &= w - 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
+template<typename Allocator>
+typename ft::vector<bool, Allocator>::size_type
+ft::vector<bool, Allocator>::lowest_bit(word_type w) {
+#if defined(__GNUC__)
+	return __builtin_ctzl(w);
+#else
+	size_type n = 0;
+	while (!(w & 1)) {
+		w >>= 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
+template<typename Allocator>
+void ft::vector<bool, Allocator>::uptocap(size_type newcap) {
+	size_type words = nwords(newcap);
+	size_type used = nwords(len);
+	word_type *tmp;
+
+	if (used > words)
+		used = words;
+	tmp = alloc.allocate(words);
+	if (used)
+		std::memcpy(tmp, arr, used * sizeof(word_type));
+	if (words > used)
+		std::memset(tmp + used, 0, (words - used) * sizeof(word_type));
+	if (arr)
+		alloc.deallocate(arr, nwords(cap));
+	arr = tmp;
+	cap = words * word_bits;
+	if (len > cap)
+		len = cap;
+}
+
+template<typename Allocator>
+void ft::vector<bool, Allocator>::fill(size_type first, size_type last, bool val) {
+	word_type full = val ? ~static_cast<word_type>(0) : 0;
+
+	while (first < last && first % word_bits)
+		set(first++, val);
+	while (first + word_bits <= last) {
+		arr[first / word_bits] = full;
+		first += word_bits;
+	}
+	while (first < last)
+		set(first++, val);
+}
+
+template<typename Allocator>
+void ft::vector<bool, Allocator>::open_gap(size_type pos, size_type n) {
+	size_type i = len;
+
+	if (len + n > cap)
+		uptocap(len + n > cap * 2 ? len + n : cap * 2);
+	len += n;
+	while (i > pos) {
+		i--;
+		set(i + n, get(i));
+	}
+}
+
+template<typename Allocator>
+template<typename Op>
+void ft::vector<bool, Allocator>::bitwise(const vector &x) {
+	size_type n = nwords(len);
+	size_type i = 0;
+
+	if (x.len != len)
+		throw std::invalid_argument("vector<bool>: bitwise size mismatch");
+#if defined(__SSE2__)
+	for (; i + 2 <= n; i += 2) {
+		__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(arr + i));
+		__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x.arr + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(arr + i), Op::apply(a, b));
+	}
+#endif
+	for (; i < n; i++)
+		arr[i] = Op::apply(arr[i], x.arr[i]);
+}
+
+//Element acsses:
+template<typename Allocator>
+typename ft::vector<bool, Allocator>::reference
+ft::vector<bool, Allocator>::at(const size_type n) {
+	if (n < len)
+		return (*this)[n];
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+template<typename Allocator>
+typename ft::vector<bool, Allocator>::const_reference
+ft::vector<bool, Allocator>::at(const size_type n) const {
+	if (n < len)
+		return get(n);
+	char err[128];
+	snprintf(err, 128, OOR_MSG.c_str(), n, len);
+	throw std::out_of_range(err);
+}
+
+//Capacity:
+template<typename Allocator>
+void ft::vector<bool, Allocator>::resize(const size_type n, const value_type val) {
+	if (n <= len) {
+		fill(n, len, false);
+		len = n;
+		return;
+	}
+	reserve(n);
+	fill(len, n, val);
+	len = n;
+}
+
+//Modifiers:
+template<typename Allocator>
+template<typename InputIterator>
+typename ft::IsInputIter<InputIterator, ft::setVoid>::type
+ft::vector<bool, Allocator>::assign(InputIterator first, InputIterator last) {
+	resize(0);
+	while (first != last)
+		push_back(*first++);
+}
+
+template<typename Allocator>
+void ft::vector<bool, Allocator>::assign(
+		const size_type n, const value_type &val) {
+	resize(0);
+	resize(n, val);
+}
+
+template<typename Allocator>
+void ft::vector<bool, Allocator>::push_back(const value_type &value) {
+	if (len == cap)
+		uptocap(cap ? cap * 2 : word_bits);
+	if (value)
+		arr[len / word_bits] |= mask(len);
+	len++;
+}
+
+template<typename Allocator>
+typename ft::vector<bool, Allocator>::iterator
+ft::vector<bool, Allocator>::insert(iterator position, const value_type &val) {
+	size_type pos = position.base();
+
+	insert(position, 1, val);
+	return begin() + pos;
+}
+
+template<typename Allocator>
+void ft::vector<bool, Allocator>::insert(
+		iterator position, size_t n, const value_type &val) {
+	size_type pos = position.base();
+
+	if (n == 0)
+		return;
+	open_gap(pos, n);
+	fill(pos, pos + n, val);
+}
+
+template<typename Allocator>
+template<typename InputIterator>
+void ft::vector<bool, Allocator>::insert(
+		iterator position, InputIterator first,
+		typename IsInputIter<InputIterator>::type last) {
+	size_type pos = position.base();
+	size_type n = ft::distance(first, last);
+
+	if (n == 0)
+		return;
+	open_gap(pos, n);
+	while (first != last)
+		set(pos++, *first++);
+}
+
+template<typename Allocator>
+typename ft::vector<bool, Allocator>::iterator
+ft::vector<bool, Allocator>::erase(iterator position) {
+	return erase(position, position + 1);
+}
+
+template<typename Allocator>
+typename ft::vector<bool, Allocator>::iterator
+ft::vector<bool, Allocator>::erase(iterator first, iterator last) {
+	size_type pos = first.base();
+	size_type n = last.base() - first.base();
+
+	if (last.base() < first.base())
+		throw std::out_of_range("ft::vector::erase: iterator out of range");
+	for (size_type i = pos + n; i < len; i++)
+		set(i - n, get(i));
+	resize(len - n);
+	return begin() + pos;
+}
+
+template<typename Allocator>
+void ft::vector<bool, Allocator>::swap(vector &x) {
+	if (this == &x)
+		return;
+
+	word_type *xarr = x.arr;
+	size_type xlen = x.len;
+	size_type xcap = x.cap;
+
+	x.arr = arr;
+	x.len = len;
+	x.cap = cap;
+
+	arr = xarr;
+	len = xlen;
+	cap = xcap;
+}
+
+template<typename Allocator>
+void ft::vector<bool, Allocator>::clear(void) {
+	if (arr)
+		alloc.deallocate(arr, nwords(cap));
+	arr = NULL;
+	len = 0;
+	cap = 0;
+}
+
+template<typename Allocator>
+void ft::vector<bool, Allocator>::flip(void) {
+	size_type n = nwords(len);
+
+	for (size_type i = 0; i < n; i++)
+		arr[i] = ~arr[i];
+	fill(len, n * word_bits, false);
+}
+
+//Bit operations:
+template<typename Allocator>
+typename ft::vector<bool, Allocator>::size_type
+ft::vector<bool, Allocator>::count(void) const {
+	size_type n = nwords(len);
+	size_type res = 0;
+
+	for (size_type i = 0; i < n; i++)
+		res += popcount(arr[i]);
+	return res;
+}
+
+template<typename Allocator>
+typename ft::vector<bool, Allocator>::size_type
+ft::vector<bool, Allocator>::find_from(size_type pos) const {
+	size_type n = nwords(len);
+	size_type i = pos / word_bits;
+	word_type w;
+
+	if (pos >= len)
+		return npos;
+	w = arr[i] & ~(mask(pos) - 1);
+	while (true) {
+		if (w)
+			return i * word_bits + lowest_bit(w);
+		if (++i >= n)
+			return npos;
+		w = arr[i];
+	}
+}
+
+
+//Iterator: word array plus bit index, base() is the bit index.
+template<typename Allocator>
+template<bool IsConst>
+struct ft::vector<bool, Allocator>::common_iterator
+		: public iterator_base<std::random_access_iterator_tag, bool, ptrdiff_t,
+				typename conditional<IsConst, reference *, const bool *>::type,
+				typename conditional<IsConst, reference, bool>::type> {
+	typedef
+	typename common_iterator::iterator_base::difference_type diff_t;
+
+	typedef
+	typename conditional_t<IsConst, reference, bool>::type ref_t;
+
+	typedef
+	typename conditional_t<IsConst, iterator, const_iterator>::type iter_t;
+
+private:
+	word_type *words;
+	size_type pos;
+
+public:
+	common_iterator(void) : words(NULL), pos(0) {}
+
+	common_iterator(word_type *_words, size_type _pos)
+			: words(_words), pos(_pos) {}
+
+	common_iterator(const iterator &inst)
+			: words(inst.wordsBase()), pos(inst.base()) {}
+
+	~common_iterator(void) {}
+
+	iter_t &operator=(const iterator &inst) {
+		words = inst.wordsBase();
+		pos = inst.base();
+		return *this;
+	}
+
+	iter_t operator+(diff_t n) const { return iter_t(words, pos + n); }
+
+	iter_t operator-(diff_t n) const { return iter_t(words, pos - n); }
+
+	template<bool C>
+	diff_t operator-(const common_iterator<C> &rhs) const {
+		return static_cast<diff_t>(pos) - static_cast<diff_t>(rhs.base());
+	}
+
+	iter_t &operator+=(diff_t n) {
+		pos += n;
+		return *this;
+	}
+
+	iter_t &operator-=(diff_t n) {
+		pos -= n;
+		return *this;
+	}
+
+	iter_t &operator++(void) {
+		++pos;
+		return *this;
+	}
+
+	iter_t operator++(int) { return iter_t(words, pos++); }
+
+	iter_t &operator--(void) {
+		--pos;
+		return *this;
+	}
+
+	iter_t operator--(int) { return iter_t(words, pos--); }
+
+	ref_t operator*(void) const {
+		return reference(&words[pos / word_bits], mask(pos));
+	}
+
+	ref_t operator[](diff_t n) const { return *(*this + n); }
+
+	size_type base(void) const { return pos; }
+
+	word_type *wordsBase(void) const { return words; }
+
+	void swap(iter_t &rhs) {
+		iter_t tmp = *this;
+		*this = rhs;
+		rhs = tmp;
+	}
+};
+}
+
+#endif //FT_CONTAINERS_FINAL_VECTOR_BOOL_HPP
@@ -0,0 +1,63 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#ifndef FT_CONTAINERS_FINAL_VECTOR_IO_HPP
+#define FT_CONTAINERS_FINAL_VECTOR_IO_HPP
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "vector.hpp"
+
+namespace ft {
+//ft::read_into: lets reader write straight into the spare capacity of v.
+//reader(buf, max) works like read(2): it returns the number of elements
+//written to buf, 0 at the end of input or -1 on error. Only for trivially
+//constructible T.
+template<typename T, typename Allocator, typename Reader>
+ssize_t read_into(vector<T, Allocator> &v, size_t max, Reader reader) {
+	ssize_t got = reader(v.prepare(max), max);
+
+	if (got > 0)
+		v.commit(got);
+	return got;
+}
+
+//ft::fd_reader: read(2) on fd, as a reader for read_into.
+struct fd_reader {
+	int fd;
+
+	explicit fd_reader(int _fd) : fd(_fd) {}
+
+	ssize_t operator()(char *buf, size_t n) const { return ::read(fd, buf, n); }
+};
+
+//ft::read_all: reads fd until the end of input, chunk bytes per call.
+//Returns the number of bytes appended, or -1 with errno set.
+template<typename Allocator>
+ssize_t read_all(vector<char, Allocator> &v, int fd, size_t chunk = 1 << 16) {
+	size_t start = v.size();
+	ssize_t got;
+
+	while ((got = read_into(v, chunk, fd_reader(fd))) > 0)
+		;
+	if (got < 0)
+		return -1;
+	return v.size() - start;
+}
+
+//ft::as_iovec: elements from index from on as one iovec, for writev(2).
+//Valid until the vector reallocates.
+template<typename T, typename Allocator>
+struct iovec as_iovec(const vector<T, Allocator> &v, size_t from = 0) {
+	struct iovec iov;
+
+	iov.iov_base = const_cast<T *>(v.data() + from);
+	iov.iov_len = (v.size() - from) * sizeof(T);
+	return iov;
+}
+}
+
+#endif //FT_CONTAINERS_FINAL_VECTOR_IO_HPP
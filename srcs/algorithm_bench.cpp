@@ -0,0 +1,98 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdint.h>
+#include <algorithm.hpp>
+
+//64 bytes: a key and a payload that every move drags along.
+struct algorithm_bench_record {
+    typedef uint32_t result_type;
+
+    uint32_t key;
+    char     payload[60];
+
+    uint32_t operator()(const algorithm_bench_record &r) const { return r.key; }
+};
+
+struct algorithm_bench_by_key {
+    bool operator()(const algorithm_bench_record &a,
+        const algorithm_bench_record &b) const { return a.key < b.key; }
+};
+
+template<typename Vector, typename Sort>
+void    algorithm_bench_run(const std::string &name, const Vector &input,
+    Sort sort)
+{
+    Vector  work(input);
+    double  start;
+
+    start = bench_now();
+    sort(work);
+    bench_report(name, input.size(), bench_now() - start, 0);
+    bench_keep(work.size());
+}
+
+#define ALGORITHM_BENCH_SORT(name, type, call) \
+    struct name { void operator()(type &v) const { call; } }
+
+typedef ft::vector<int> algorithm_bench_ints;
+typedef ft::vector<algorithm_bench_record> algorithm_bench_records;
+
+ALGORITHM_BENCH_SORT(algorithm_bench_std_sort, algorithm_bench_ints,
+    std::sort(v.begin(), v.end()));
+ALGORITHM_BENCH_SORT(algorithm_bench_std_stable, algorithm_bench_ints,
+    std::stable_sort(v.begin(), v.end()));
+ALGORITHM_BENCH_SORT(algorithm_bench_std_partial, algorithm_bench_ints,
+    std::partial_sort(v.begin(), v.begin() + 1000, v.end()));
+ALGORITHM_BENCH_SORT(algorithm_bench_ft_sort, algorithm_bench_ints,
+    ft::sort(v.begin(), v.end()));
+ALGORITHM_BENCH_SORT(algorithm_bench_ft_stable, algorithm_bench_ints,
+    ft::stable_sort(v.begin(), v.end()));
+ALGORITHM_BENCH_SORT(algorithm_bench_ft_partial, algorithm_bench_ints,
+    ft::partial_sort(v.begin(), v.begin() + 1000, v.end()));
+ALGORITHM_BENCH_SORT(algorithm_bench_ft_radix, algorithm_bench_ints,
+    ft::radix_sort(v.begin(), v.end()));
+ALGORITHM_BENCH_SORT(algorithm_bench_std_sort_rec, algorithm_bench_records,
+    std::sort(v.begin(), v.end(), algorithm_bench_by_key()));
+ALGORITHM_BENCH_SORT(algorithm_bench_ft_sort_rec, algorithm_bench_records,
+    ft::sort(v.begin(), v.end(), algorithm_bench_by_key()));
+ALGORITHM_BENCH_SORT(algorithm_bench_ft_stable_rec, algorithm_bench_records,
+    ft::stable_sort(v.begin(), v.end(), algorithm_bench_by_key()));
+ALGORITHM_BENCH_SORT(algorithm_bench_ft_radix_rec, algorithm_bench_records,
+    ft::radix_sort(v.begin(), v.end(), algorithm_bench_record()));
+
+void    algorithm_bench(void)
+{
+    const size_t    count = 1 << 22;
+    const size_t    records = 1 << 20;
+    algorithm_bench_ints ints(count);
+    algorithm_bench_records recs(records);
+
+    srand(42);
+    for (size_t i = 0; i < count; i++)
+        ints[i] = rand();
+    for (size_t i = 0; i < records; i++)
+        recs[i].key = rand();
+    std::cout << "### sorting " << count << " random ints (ns per element)"
+        << std::endl;
+    algorithm_bench_run("std::sort", ints, algorithm_bench_std_sort());
+    algorithm_bench_run("ft::sort", ints, algorithm_bench_ft_sort());
+    algorithm_bench_run("std::stable_sort", ints, algorithm_bench_std_stable());
+    algorithm_bench_run("ft::stable_sort", ints, algorithm_bench_ft_stable());
+    algorithm_bench_run("ft::radix_sort", ints, algorithm_bench_ft_radix());
+    algorithm_bench_run("std::partial_sort, top 1000", ints,
+        algorithm_bench_std_partial());
+    algorithm_bench_run("ft::partial_sort, top 1000", ints,
+        algorithm_bench_ft_partial());
+    std::cout << "### sorting " << records << " 64-byte records by key"
+        << std::endl;
+    algorithm_bench_run("std::sort", recs, algorithm_bench_std_sort_rec());
+    algorithm_bench_run("ft::sort", recs, algorithm_bench_ft_sort_rec());
+    algorithm_bench_run("ft::stable_sort", recs,
+        algorithm_bench_ft_stable_rec());
+    algorithm_bench_run("ft::radix_sort, key extractor", recs,
+        algorithm_bench_ft_radix_rec());
+}
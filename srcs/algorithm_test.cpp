@@ -0,0 +1,141 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+
+#include <algorithm.hpp>
+#include <pair.hpp>
+
+struct algorithm_test_record {
+    int key;
+    int order;
+};
+
+struct algorithm_test_by_key {
+    typedef int result_type;
+
+    bool operator()(const algorithm_test_record &a,
+        const algorithm_test_record &b) const { return a.key < b.key; }
+
+    int operator()(const algorithm_test_record &r) const { return r.key; }
+};
+
+static double algorithm_test_negate(const double &x) { return -x; }
+
+template<typename T>
+static bool algorithm_test_check(T (*gen)(int))
+{
+    bool ok = true;
+
+    for (int n = 0; n < 3000; n = n * 3 + 1)
+    {
+        ft::vector<T> v;
+        for (int i = 0; i < n; i++)
+            v.push_back(gen(i));
+        std::vector<T> ref(v.begin(), v.end());
+        std::sort(ref.begin(), ref.end());
+        ft::vector<T> s(v);
+        ft::sort(s.begin(), s.end());
+        ok = ok && std::equal(ref.begin(), ref.end(), s.begin());
+        s = v;
+        ft::stable_sort(s.begin(), s.end());
+        ok = ok && std::equal(ref.begin(), ref.end(), s.begin());
+        s = v;
+        ft::radix_sort(s.begin(), s.end());
+        ok = ok && std::equal(ref.begin(), ref.end(), s.begin());
+        s = v;
+        ft::partial_sort(s.begin(), s.begin() + n / 3, s.end());
+        ok = ok && std::equal(ref.begin(), ref.begin() + n / 3, s.begin());
+    }
+    return ok;
+}
+
+static int algorithm_test_random(int) { return rand() % 2000 - 1000; }
+
+static int algorithm_test_few(int) { return rand() % 3; }
+
+static int algorithm_test_descending(int i) { return -i; }
+
+static long algorithm_test_long(int) { return (long)rand() * rand() - rand(); }
+
+static unsigned char algorithm_test_byte(int) { return rand(); }
+
+static double algorithm_test_double(int)
+{
+    return (rand() - RAND_MAX / 2) / 1000.0;
+}
+
+void    algorithm_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::SORT / STABLE_SORT / PARTIAL_SORT / RADIX_SORT"
+        << std::endl;
+    srand(43);
+    std::cout << "random ints: " << algorithm_test_check(algorithm_test_random)
+        << std::endl;
+    std::cout << "three distinct values: "
+        << algorithm_test_check(algorithm_test_few) << std::endl;
+    std::cout << "descending: "
+        << algorithm_test_check(algorithm_test_descending) << std::endl;
+    std::cout << "long: " << algorithm_test_check(algorithm_test_long)
+        << std::endl;
+    std::cout << "unsigned char: " << algorithm_test_check(algorithm_test_byte)
+        << std::endl;
+    std::cout << "double: " << algorithm_test_check(algorithm_test_double)
+        << std::endl;
+
+    std::cout << "### FT::SORT: other ranges" << std::endl;
+    int raw[] = {5, -1, 3, 3, 0, 12, -7};
+    ft::sort(raw, raw + 7);
+    for (int i = 0; i < 7; i++)
+        std::cout << raw[i] << " ";
+    std::cout << std::endl;
+    std::string word = "introsort";
+    ft::sort(word.begin(), word.end());
+    std::cout << word << std::endl;
+    ft::vector<std::string> names;
+    names.push_back("pear");
+    names.push_back("apple");
+    names.push_back("fig");
+    ft::sort(names.begin(), names.end());
+    std::cout << names[0] << " " << names[1] << " " << names[2] << std::endl;
+    float f[] = {2.5f, -0.0f, -3.25f, 0.0f, 1e-30f, -1e30f};
+    ft::radix_sort(f, f + 6);
+    for (int i = 0; i < 6; i++)
+        std::cout << f[i] << " ";
+    std::cout << std::endl;
+
+    std::cout << "### FT::STABLE_SORT / RADIX_SORT: records by key"
+        << std::endl;
+    ft::vector<algorithm_test_record> recs;
+    for (int i = 0; i < 5000; i++)
+    {
+        algorithm_test_record r = {rand() % 50 - 25, i};
+        recs.push_back(r);
+    }
+    ft::vector<algorithm_test_record> st(recs);
+    ft::stable_sort(st.begin(), st.end(), algorithm_test_by_key());
+    ft::vector<algorithm_test_record> rx(recs);
+    ft::radix_sort(rx.begin(), rx.end(), algorithm_test_by_key());
+    bool ok = true;
+    for (size_t i = 1; i < st.size(); i++)
+        ok = ok && (st[i - 1].key < st[i].key || (st[i - 1].key == st[i].key
+            && st[i - 1].order < st[i].order));
+    for (size_t i = 0; i < st.size(); i++)
+        ok = ok && st[i].key == rx[i].key && st[i].order == rx[i].order;
+    std::cout << "stable and radix agree: " << ok << std::endl;
+    ft::vector<double> d(100);
+    for (size_t i = 0; i < d.size(); i++)
+        d[i] = algorithm_test_double(0);
+    ft::radix_sort(d.begin(), d.end(), algorithm_test_negate);
+    ok = true;
+    for (size_t i = 1; i < d.size(); i++)
+        ok = ok && d[i - 1] >= d[i];
+    std::cout << "function pointer key, descending: " << ok << std::endl;
+    std::cout << std::endl;
+}
@@ -0,0 +1,115 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <cstdlib>
+#include <new>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <sstream>
+#include <time.h>
+#include <pthread.h>
+#include <vector.hpp>
+
+//Every operator new in the benchmark binary goes through here so that the
+//benchmarks can report allocations per operation.
+static size_t           g_bench_allocs = 0;
+static volatile size_t  g_bench_sink = 0;
+
+#if defined(__GNUC__)
+__attribute__((noinline))
+#endif
+#if __cplusplus >= 201103L
+void    *operator new(std::size_t n)
+#else
+void    *operator new(std::size_t n) throw(std::bad_alloc)
+#endif
+{
+    void *p;
+
+    g_bench_allocs++;
+    p = malloc(n ? n : 1);
+    if (p == NULL)
+        throw std::bad_alloc();
+    return p;
+}
+
+#if defined(__GNUC__)
+__attribute__((noinline))
+#endif
+void    operator delete(void *p) throw()
+{
+    free(p);
+}
+
+#if __cplusplus >= 201402L
+# if defined(__GNUC__)
+__attribute__((noinline))
+# endif
+void    operator delete(void *p, std::size_t) throw()
+{
+    free(p);
+}
+#endif
+
+double  bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+size_t  bench_allocs(void)
+{
+    return g_bench_allocs;
+}
+
+void    bench_keep(size_t val)
+{
+    g_bench_sink += val;
+}
+
+void    bench_report(const std::string &name, size_t ops, double sec,
+    size_t allocs)
+{
+    std::cout << std::left << std::setw(48) << name << std::right
+        << std::fixed << std::setprecision(3)
+        << std::setw(10) << sec * 1e9 / ops << " ns/op"
+        << std::setw(10) << static_cast<double>(allocs) / ops << " allocs/op"
+        << std::endl;
+}
+
+//Threaded benchmarks: a job is a struct whose run() does one thread's
+//share of the work.
+template<typename Job>
+static void *bench_thread(void *job)
+{
+    static_cast<Job *>(job)->run();
+    return NULL;
+}
+
+//Runs every job on a thread of its own, all at once. Returns the seconds
+//from the first start to the last join.
+template<typename Job>
+double  bench_threads(ft::vector<Job> &jobs)
+{
+    ft::vector<pthread_t>   ids(jobs.size());
+    double                  start = bench_now();
+
+    for (size_t t = 0; t < jobs.size(); t++)
+        pthread_create(&ids[t], NULL, bench_thread<Job>, &jobs[t]);
+    for (size_t t = 0; t < jobs.size(); t++)
+        pthread_join(ids[t], NULL);
+    return bench_now() - start;
+}
+
+//", 1 thread", ", 4 threads": the suffix of a threaded benchmark name.
+std::string bench_thread_tag(size_t threads, const char *what = "thread")
+{
+    std::ostringstream  tag;
+
+    tag << ", " << threads << " " << what << (threads > 1 ? "s" : "");
+    return tag.str();
+}
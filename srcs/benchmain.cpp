@@ -0,0 +1,58 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include "bench_utils.cpp"
+#include "vector_bench.cpp"
+#include "vector_io_bench.cpp"
+#include "small_map_bench.cpp"
+#include "small_vector_bench.cpp"
+#include "vector_bool_bench.cpp"
+#include "deque_bench.cpp"
+#include "devector_bench.cpp"
+#include "mapped_vector_bench.cpp"
+#include "mmap_allocator_bench.cpp"
+#include "stable_vector_bench.cpp"
+#include "incremental_vector_bench.cpp"
+#include "soa_vector_bench.cpp"
+#include "compressed_vector_bench.cpp"
+#include "simd_compare_bench.cpp"
+#include "par_bench.cpp"
+#include "algorithm_bench.cpp"
+#include "priority_queue_bench.cpp"
+#include "concurrent_stack_bench.cpp"
+#include "concurrent_queue_bench.cpp"
+#include "concurrent_skiplist_map_bench.cpp"
+#include "rcu_map_bench.cpp"
+#include "sharded_map_bench.cpp"
+#include "concurrent_vector_bench.cpp"
+#include "move_bench.cpp"
+
+int main(void)
+{
+    vector_bench();
+    vector_io_bench();
+    small_map_bench();
+    small_vector_bench();
+    vector_bool_bench();
+    deque_bench();
+    devector_bench();
+    mapped_vector_bench();
+    mmap_allocator_bench();
+    stable_vector_bench();
+    incremental_vector_bench();
+    soa_vector_bench();
+    compressed_vector_bench();
+    simd_compare_bench();
+    par_bench();
+    algorithm_bench();
+    priority_queue_bench();
+    concurrent_stack_bench();
+    concurrent_queue_bench();
+    concurrent_skiplist_map_bench();
+    rcu_map_bench();
+    sharded_map_bench();
+    concurrent_vector_bench();
+    move_bench();
+    return 0;
+}
@@ -0,0 +1,96 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdint.h>
+#include <vector.hpp>
+#include <compressed_vector.hpp>
+
+void    compressed_vector_bench(void)
+{
+    const size_t    count = 1 << 24;
+    const size_t    lookups = 1 << 20;
+    ft::vector<uint64_t> plain;
+    ft::compressed_vector<uint64_t> packed;
+    uint64_t        id = 0;
+    uint64_t        sum;
+    uint64_t        buf[ft::compressed_vector<uint64_t>::block_size];
+    double          start;
+
+    srand(42);
+    plain.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        id += 1 + rand() % 64;
+        plain.push_back(id);
+        packed.push_back(id);
+    }
+    std::cout << "### " << count << " sorted 64-bit ids, gaps of 1..64: "
+        << std::fixed << std::setprecision(2)
+        << packed.memory_usage() * 8.0 / count << " bits per id, ratio "
+        << static_cast<double>(count * sizeof(uint64_t))
+            / packed.memory_usage() << std::endl;
+    {
+        sum = 0;
+        start = bench_now();
+        for (size_t i = 0; i < count; i++)
+            sum += plain[i];
+        bench_report("ft::vector<uint64_t> scan", count, bench_now() - start,
+            0);
+        bench_keep(sum);
+    }
+    {
+        sum = 0;
+        start = bench_now();
+        for (size_t b = 0; b < packed.block_count(); b++)
+        {
+            size_t n = packed.decode(b, buf);
+            for (size_t i = 0; i < n; i++)
+                sum += buf[i];
+        }
+        bench_report("ft::compressed_vector decode() scan", count,
+            bench_now() - start, 0);
+        bench_keep(sum);
+    }
+    {
+        sum = 0;
+        start = bench_now();
+        for (ft::compressed_vector<uint64_t>::const_iterator it
+            = packed.begin(); it != packed.end(); ++it)
+            sum += *it;
+        bench_report("ft::compressed_vector iterator scan", count,
+            bench_now() - start, 0);
+        bench_keep(sum);
+    }
+    {
+        sum = 0;
+        start = bench_now();
+        for (size_t i = 0; i < lookups; i++)
+            sum += packed[(i * 2654435761u) % count];
+        bench_report("ft::compressed_vector operator[] random", lookups,
+            bench_now() - start, 0);
+        bench_keep(sum);
+    }
+    {
+        sum = 0;
+        start = bench_now();
+        for (size_t i = 0; i < lookups; i++)
+            sum += *std::lower_bound(plain.begin(), plain.end(),
+                (i * 2654435761u) % id);
+        bench_report("std::lower_bound on ft::vector<uint64_t>", lookups,
+            bench_now() - start, 0);
+        bench_keep(sum);
+    }
+    {
+        sum = 0;
+        start = bench_now();
+        for (size_t i = 0; i < lookups; i++)
+            sum += *packed.lower_bound((i * 2654435761u) % id);
+        bench_report("ft::compressed_vector::lower_bound", lookups,
+            bench_now() - start, 0);
+        bench_keep(sum);
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,98 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+
+#include <compressed_vector.hpp>
+
+void    compressed_vector_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::COMPRESSED_VECTOR: sorted ids round trip" << std::endl;
+    ft::vector<unsigned long> ids;
+    unsigned long id = 1000000;
+    srand(7);
+    for (int i = 0; i < 1000; i++)
+    {
+        id += rand() % 50;
+        ids.push_back(id);
+    }
+    ft::compressed_vector<unsigned long> c(ids.begin(), ids.end());
+    bool ok = true;
+    size_t i = 0;
+    for (ft::compressed_vector<unsigned long>::const_iterator it = c.begin();
+        it != c.end(); ++it, ++i)
+        ok = ok && *it == ids[i];
+    std::cout << "size: " << c.size() << ", blocks: " << c.block_count()
+        << ", iteration matches: " << ok << std::endl;
+    ok = true;
+    for (i = 0; i < ids.size(); i++)
+        ok = ok && c[i] == ids[i];
+    std::cout << "operator[] matches: " << ok << ", front: " << c.front()
+        << ", back: " << c.back() << ", at(999): " << c.at(999) << std::endl;
+    std::cout << "bytes: " << c.memory_usage() << " instead of "
+        << ids.size() * sizeof(unsigned long) << std::endl;
+
+    std::cout << "### FT::COMPRESSED_VECTOR: lower_bound" << std::endl;
+    ok = true;
+    for (i = 0; i < ids.size(); i += 37)
+    {
+        ok = ok && *c.lower_bound(ids[i]) == ids[i];
+        ok = ok && c.lower_bound(ids[i] + 1).base()
+            == static_cast<size_t>(std::upper_bound(ids.begin(), ids.end(),
+                ids[i]) - ids.begin());
+    }
+    std::cout << "matches std::lower_bound: " << ok << std::endl;
+    std::cout << "before all: " << c.lower_bound(0).base() << ", past all: "
+        << (c.lower_bound(id + 1) == c.end()) << std::endl;
+
+    std::cout << "### FT::COMPRESSED_VECTOR: signed, unsorted, extremes"
+        << std::endl;
+    ft::compressed_vector<int> s;
+    int vals[] = {5, -3, 2147483647, -2147483647 - 1, 0, 0, 0, 42};
+    for (int k = 0; k < 200; k++)
+        s.push_back(vals[k % 8]);
+    ok = true;
+    for (int k = 0; k < 200; k++)
+        ok = ok && s[k] == vals[k % 8];
+    std::cout << "round trip: " << ok << std::endl;
+    ft::compressed_vector<char> z;
+    for (int k = 0; k < 300; k++)
+        z.push_back('z');
+    std::cout << "constant run: " << z[0] << z[150] << z[299] << ", bytes: "
+        << z.memory_usage() << std::endl;
+    ft::compressed_vector<char> y;
+    y.swap(z);
+    std::cout << "after swap: " << y.size() << " " << z.size() << ", y == z: "
+        << (y == z) << std::endl;
+    try
+    {
+        z.at(0);
+    }
+    catch (std::out_of_range &e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+
+    std::cout << "### FT::COMPRESSED_VECTOR: iterators return values"
+        << std::endl;
+    typedef ft::compressed_vector<int>::const_iterator citer;
+    citer it = s.begin() + 126;
+    citer same = it;
+    ok = *it == *same;
+    for (int k = 126; k < 131; k++)
+        ok = ok && *it++ == vals[k % 8];
+    std::cout << "*it++ across a block end: " << ok << std::endl;
+    ft::common_reverse_iterator<citer> rit(s.end());
+    ft::common_reverse_iterator<citer> rend(s.begin());
+    ok = true;
+    for (int k = 199; rit != rend; ++rit, k--)
+        ok = ok && *rit == vals[k % 8];
+    std::cout << "reverse iteration: " << ok << std::endl;
+    std::cout << std::endl;
+}
@@ -0,0 +1,196 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <sstream>
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <concurrent_queue.hpp>
+#include <deque.hpp>
+
+//The baseline: a bounded ft::deque behind one mutex.
+struct concurrent_queue_bench_locked {
+    pthread_mutex_t lock;
+    ft::deque<int>  items;
+    size_t          cap;
+
+    explicit concurrent_queue_bench_locked(size_t _cap): cap(_cap)
+    {
+        pthread_mutex_init(&lock, NULL);
+    }
+    ~concurrent_queue_bench_locked(void) { pthread_mutex_destroy(&lock); }
+
+    size_t push_n(const int *first, size_t n)
+    {
+        pthread_mutex_lock(&lock);
+        if (n > cap - items.size())
+            n = cap - items.size();
+        for (size_t i = 0; i < n; i++)
+            items.push_back(first[i]);
+        pthread_mutex_unlock(&lock);
+        return n;
+    }
+
+    size_t pop_n(int *out, size_t n)
+    {
+        pthread_mutex_lock(&lock);
+        if (n > items.size())
+            n = items.size();
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = items.front();
+            items.pop_front();
+        }
+        pthread_mutex_unlock(&lock);
+        return n;
+    }
+};
+
+//Producers push count elements in batches, consumers pop count elements.
+//Waits by yielding: with fewer CPUs than threads spinning only delays the
+//thread that would make progress.
+template<typename Queue>
+struct concurrent_queue_bench_job {
+    Queue   *queue;
+    bool    producer;
+    size_t  count;
+    size_t  batch;
+    size_t  sum;
+
+    void run(void)
+    {
+        int items[64];
+
+        for (size_t i = 0; i < batch; i++)
+            items[i] = static_cast<int>(i);
+        for (size_t done = 0; done < count;)
+        {
+            size_t n = count - done < batch ? count - done : batch;
+            size_t moved = producer ? queue->push_n(items, n)
+                : queue->pop_n(items, n);
+            if (moved == 0)
+                sched_yield();
+            for (size_t i = 0; !producer && i < moved; i++)
+                sum += items[i];
+            done += moved;
+        }
+    }
+};
+
+//Throughput: producers push ops elements in batches, consumers pop them.
+template<typename Queue>
+static void concurrent_queue_bench_run(const std::string &name, Queue &queue,
+    size_t producers, size_t consumers, size_t batch, size_t ops)
+{
+    ft::vector<concurrent_queue_bench_job<Queue> >  jobs(producers + consumers);
+    std::ostringstream                              tag;
+    size_t                                          sum = 0;
+    double                                          sec;
+
+    for (size_t t = 0; t < jobs.size(); t++)
+    {
+        jobs[t].queue = &queue;
+        jobs[t].producer = t < producers;
+        jobs[t].count = t < producers ? ops / producers : ops / consumers;
+        jobs[t].batch = batch;
+        jobs[t].sum = 0;
+    }
+    sec = bench_threads(jobs);
+    for (size_t t = 0; t < jobs.size(); t++)
+        sum += jobs[t].sum;
+    tag << name << ", " << producers << "p/" << consumers << "c, batch "
+        << batch;
+    bench_report(tag.str(), ops, sec, 0);
+    bench_keep(sum);
+}
+
+//The first job sends one element and waits for it to come back, the
+//second one sends every element it gets back.
+template<typename Queue>
+struct concurrent_queue_bench_pong {
+    Queue   *in;
+    Queue   *out;
+    bool    first;
+    size_t  rounds;
+
+    void run(void)
+    {
+        int val = 1;
+
+        for (size_t i = 0; i < rounds; i++)
+        {
+            if (first)
+                while (out->push_n(&val, 1) == 0)
+                    sched_yield();
+            while (in->pop_n(&val, 1) == 0)
+                sched_yield();
+            if (!first)
+                while (out->push_n(&val, 1) == 0)
+                    sched_yield();
+        }
+    }
+};
+
+//Latency: one element goes to another thread and back, per round trip.
+template<typename Queue>
+static void concurrent_queue_bench_latency(const std::string &name,
+    Queue &ping, Queue &pong, size_t rounds)
+{
+    ft::vector<concurrent_queue_bench_pong<Queue> > jobs(2);
+
+    jobs[0].in = &pong;
+    jobs[0].out = &ping;
+    jobs[0].first = true;
+    jobs[1].in = &ping;
+    jobs[1].out = &pong;
+    jobs[1].first = false;
+    jobs[0].rounds = jobs[1].rounds = rounds;
+    bench_report(name + " round trip", rounds, bench_threads(jobs), 0);
+}
+
+void    concurrent_queue_bench(void)
+{
+    const size_t    ops = 1 << 22;
+    const size_t    cap = 1024;
+    const size_t    rounds = 1 << 16;
+    long            cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    std::cout << "### concurrent queues, " << ops << " elements through "
+        << cap << " slots, " << cpus << " online CPUs" << std::endl;
+    for (size_t batch = 1; batch <= 32; batch *= 32)
+    {
+        for (size_t t = 1; t <= 4; t *= 2)
+        {
+            {
+                concurrent_queue_bench_locked q(cap);
+                concurrent_queue_bench_run("mutex + ft::deque", q, t, t, batch,
+                    ops);
+            }
+            if (t == 1)
+            {
+                ft::spsc_queue<int> q(cap);
+                concurrent_queue_bench_run("ft::spsc_queue", q, 1, 1, batch,
+                    ops);
+            }
+            {
+                ft::mpmc_queue<int> q(cap);
+                concurrent_queue_bench_run("ft::mpmc_queue", q, t, t, batch,
+                    ops);
+            }
+        }
+    }
+    {
+        concurrent_queue_bench_locked ping(cap), pong(cap);
+        concurrent_queue_bench_latency("mutex + ft::deque", ping, pong,
+            rounds);
+    }
+    {
+        ft::spsc_queue<int> ping(cap), pong(cap);
+        concurrent_queue_bench_latency("ft::spsc_queue", ping, pong, rounds);
+    }
+    {
+        ft::mpmc_queue<int> ping(cap), pong(cap);
+        concurrent_queue_bench_latency("ft::mpmc_queue", ping, pong, rounds);
+    }
+}
@@ -0,0 +1,231 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sched.h>
+#include <pthread.h>
+
+#include <concurrent_queue.hpp>
+
+static const int concurrent_queue_test_count = 50000;
+
+struct concurrent_queue_test_job {
+    ft::spsc_queue<int> *spsc;
+    ft::mpmc_queue<int> *mpmc;
+    int                 first;
+    int                 count;
+    std::vector<int>    popped;
+    int                 *done;
+    bool                sizes_ok;
+};
+
+//Pushes first .. first + count - 1, alternating single pushes and
+//batches of up to 7.
+template<typename Queue>
+static void concurrent_queue_test_produce(Queue &q, int first, int count)
+{
+    int batch[7];
+
+    for (int i = 0; i < count;)
+    {
+        int n = (i / 7) % 2 ? 1 : 7;
+        if (n > count - i)
+            n = count - i;
+        for (int j = 0; j < n; j++)
+            batch[j] = first + i + j;
+        int pushed = static_cast<int>(q.push_n(batch, n));
+        if (pushed == 0)
+            sched_yield();
+        i += pushed;
+    }
+}
+
+//Pops until count values came out, alternating single pops and batches.
+template<typename Queue>
+static void concurrent_queue_test_consume(Queue &q, std::vector<int> &out,
+    int count)
+{
+    int batch[5];
+
+    while (static_cast<int>(out.size()) < count)
+    {
+        size_t n = q.pop_n(batch, out.size() % 2 ? 1 : 5);
+        if (n == 0)
+            sched_yield();
+        out.insert(out.end(), batch, batch + n);
+    }
+}
+
+static void *concurrent_queue_test_spsc_producer(void *arg)
+{
+    concurrent_queue_test_job *job
+        = static_cast<concurrent_queue_test_job *>(arg);
+
+    concurrent_queue_test_produce(*job->spsc, job->first, job->count);
+    return NULL;
+}
+
+//A third thread: size() has to stay in [0, capacity()] while both sides
+//run.
+static void *concurrent_queue_test_spsc_observer(void *arg)
+{
+    concurrent_queue_test_job *job
+        = static_cast<concurrent_queue_test_job *>(arg);
+
+    job->sizes_ok = true;
+    while (!__atomic_load_n(job->done, __ATOMIC_ACQUIRE))
+        job->sizes_ok = job->sizes_ok
+            && job->spsc->size() <= job->spsc->capacity();
+    return NULL;
+}
+
+static void *concurrent_queue_test_mpmc_producer(void *arg)
+{
+    concurrent_queue_test_job *job
+        = static_cast<concurrent_queue_test_job *>(arg);
+
+    concurrent_queue_test_produce(*job->mpmc, job->first, job->count);
+    return NULL;
+}
+
+static void *concurrent_queue_test_mpmc_consumer(void *arg)
+{
+    concurrent_queue_test_job *job
+        = static_cast<concurrent_queue_test_job *>(arg);
+    int val;
+
+    //Consumers share the total, so they stop on a -1 per consumer.
+    for (;;)
+    {
+        if (!job->mpmc->try_pop(val))
+        {
+            sched_yield();
+            continue;
+        }
+        if (val < 0)
+            return NULL;
+        job->popped.push_back(val);
+    }
+}
+
+static bool concurrent_queue_test_spsc(void)
+{
+    ft::spsc_queue<int>         q(64);
+    concurrent_queue_test_job   job;
+    pthread_t                   id;
+    pthread_t                   observer;
+    std::vector<int>            popped;
+    int                         done = 0;
+    bool                        ok = true;
+
+    job.spsc = &q;
+    job.first = 0;
+    job.count = concurrent_queue_test_count;
+    job.done = &done;
+    pthread_create(&id, NULL, concurrent_queue_test_spsc_producer, &job);
+    pthread_create(&observer, NULL, concurrent_queue_test_spsc_observer, &job);
+    concurrent_queue_test_consume(q, popped, concurrent_queue_test_count);
+    pthread_join(id, NULL);
+    __atomic_store_n(&done, 1, __ATOMIC_RELEASE);
+    pthread_join(observer, NULL);
+    for (int i = 0; i < concurrent_queue_test_count; i++)
+        ok = ok && popped[i] == i;
+    return ok && job.sizes_ok && q.empty();
+}
+
+//Every value comes out once, and each consumer sees the values of one
+//producer in the order they were pushed.
+static bool concurrent_queue_test_mpmc(void)
+{
+    const int                   producers = 3;
+    const int                   consumers = 3;
+    ft::mpmc_queue<int>         q(128);
+    concurrent_queue_test_job   jobs[producers + consumers];
+    pthread_t                   ids[producers + consumers];
+    std::vector<int>            seen(producers * concurrent_queue_test_count, 0);
+    bool                        ok = true;
+
+    for (int t = 0; t < producers + consumers; t++)
+    {
+        jobs[t].mpmc = &q;
+        jobs[t].first = t * concurrent_queue_test_count;
+        jobs[t].count = concurrent_queue_test_count;
+        pthread_create(&ids[t], NULL, t < producers
+            ? concurrent_queue_test_mpmc_producer
+            : concurrent_queue_test_mpmc_consumer, &jobs[t]);
+    }
+    for (int t = 0; t < producers; t++)
+        pthread_join(ids[t], NULL);
+    for (int t = 0; t < consumers; t++)
+        while (!q.try_push(-1))
+            sched_yield();
+    for (int t = producers; t < producers + consumers; t++)
+    {
+        pthread_join(ids[t], NULL);
+        std::vector<int> last(producers, -1);
+        for (size_t i = 0; i < jobs[t].popped.size(); i++)
+        {
+            int val = jobs[t].popped[i];
+            int from = val / concurrent_queue_test_count;
+            ok = ok && val > last[from];
+            last[from] = val;
+            seen[val]++;
+        }
+    }
+    for (size_t i = 0; i < seen.size(); i++)
+        ok = ok && seen[i] == 1;
+    return ok && q.empty();
+}
+
+void    concurrent_queue_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::SPSC_QUEUE: try_push / try_pop / push_n / pop_n"
+        << std::endl;
+    ft::spsc_queue<std::string> words(3);
+    std::string word;
+    std::cout << "capacity: " << words.capacity() << ", try_pop on empty: "
+        << words.try_pop(word) << std::endl;
+    words.try_push("one");
+    words.try_push("two");
+    words.try_push("three");
+    words.try_push("four");
+    std::cout << "full, try_push: " << words.try_push("five") << ", size: "
+        << words.size() << ", order:";
+    while (words.try_pop(word))
+        std::cout << " " << word;
+    std::cout << std::endl;
+    int in[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int out[10];
+    ft::spsc_queue<int> ints(8);
+    size_t pushed = ints.push_n(in, 10);
+    size_t popped = ints.pop_n(out, 3);
+    std::cout << "push_n(10) into 8: " << pushed << ", pop_n(3): " << popped;
+    pushed = ints.push_n(in + 8, 2);
+    std::cout << ", push_n(2): " << pushed << ", push_n(10): "
+        << ints.push_n(in, 10) << std::endl;
+    popped = ints.pop_n(out, 10);
+    std::cout << "pop_n(10): " << popped << ":";
+    for (size_t i = 0; i < popped; i++)
+        std::cout << " " << out[i];
+    std::cout << std::endl;
+    std::cout << "1 producer, 1 consumer, in order: "
+        << concurrent_queue_test_spsc() << std::endl;
+
+    std::cout << "### FT::MPMC_QUEUE: try_push / try_pop / push_n / pop_n"
+        << std::endl;
+    ft::mpmc_queue<int> shared(4);
+    int val = 0;
+    std::cout << "capacity: " << shared.capacity() << ", push_n(10): "
+        << shared.push_n(in, 10) << ", try_push when full: "
+        << shared.try_push(42) << std::endl;
+    std::cout << "try_pop: " << shared.try_pop(val) << " " << val
+        << ", pop_n(10): " << shared.pop_n(out, 10) << " " << out[0] << " "
+        << out[2] << ", empty: " << shared.empty() << std::endl;
+    std::cout << "3 producers, 3 consumers, every value once and in order: "
+        << concurrent_queue_test_mpmc() << std::endl;
+    std::cout << std::endl;
+}
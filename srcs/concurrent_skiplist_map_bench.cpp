@@ -0,0 +1,128 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <pthread.h>
+#include <unistd.h>
+#include <concurrent_skiplist_map.hpp>
+#include <map.hpp>
+
+//The baseline: ft::map behind one global mutex.
+struct concurrent_skiplist_map_bench_locked {
+    pthread_mutex_t     lock;
+    ft::map<int, int>   map;
+
+    concurrent_skiplist_map_bench_locked(void)
+    {
+        pthread_mutex_init(&lock, NULL);
+    }
+    ~concurrent_skiplist_map_bench_locked(void)
+    {
+        pthread_mutex_destroy(&lock);
+    }
+
+    void insert(const ft::pair<int, int> &val)
+    {
+        pthread_mutex_lock(&lock);
+        map.insert(val);
+        pthread_mutex_unlock(&lock);
+    }
+
+    void erase(int key)
+    {
+        pthread_mutex_lock(&lock);
+        map.erase(key);
+        pthread_mutex_unlock(&lock);
+    }
+
+    bool find(int key)
+    {
+        bool found;
+
+        pthread_mutex_lock(&lock);
+        found = map.find(key) != map.end();
+        pthread_mutex_unlock(&lock);
+        return found;
+    }
+};
+
+static bool concurrent_skiplist_map_bench_find(
+    concurrent_skiplist_map_bench_locked &map, int key)
+{
+    return map.find(key);
+}
+
+static bool concurrent_skiplist_map_bench_find(
+    ft::concurrent_skiplist_map<int, int> &map, int key)
+{
+    return map.find(key) != map.end();
+}
+
+//90% find, 5% insert, 5% erase on random keys.
+template<typename Map>
+struct concurrent_skiplist_map_bench_job {
+    Map     *map;
+    int     keys;
+    size_t  ops;
+    size_t  found;
+
+    void run(void)
+    {
+        for (size_t i = 0; i < ops; i++)
+        {
+            unsigned int r = ft::thread_random();
+            int key = static_cast<int>((r >> 8) % keys);
+            if (r % 20 == 0)
+                map->insert(ft::make_pair(key, key));
+            else if (r % 20 == 1)
+                map->erase(key);
+            else
+                found += concurrent_skiplist_map_bench_find(*map, key);
+        }
+    }
+};
+
+template<typename Map>
+static void concurrent_skiplist_map_bench_run(const std::string &name,
+    size_t threads, int keys, size_t ops)
+{
+    Map                                                 map;
+    ft::vector<concurrent_skiplist_map_bench_job<Map> > jobs(threads);
+    size_t                                              found = 0;
+    double                                              sec;
+
+    for (int k = 0; k < keys; k += 2)
+        map.insert(ft::make_pair(k, k));
+    for (size_t t = 0; t < threads; t++)
+    {
+        jobs[t].map = &map;
+        jobs[t].keys = keys;
+        jobs[t].ops = ops / threads;
+        jobs[t].found = 0;
+    }
+    sec = bench_threads(jobs);
+    for (size_t t = 0; t < threads; t++)
+        found += jobs[t].found;
+    bench_report(name, ops, sec, 0);
+    bench_keep(found);
+}
+
+void    concurrent_skiplist_map_bench(void)
+{
+    const int       keys = 1 << 17;
+    const size_t    ops = 1 << 21;
+    long            cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    std::cout << "### ordered concurrent map, " << keys << " keys, " << ops
+        << " ops: 90% find, 5% insert, 5% erase, " << cpus << " online CPUs"
+        << std::endl;
+    for (size_t t = 1; t <= 64; t *= 2)
+    {
+        std::string tag = bench_thread_tag(t);
+        concurrent_skiplist_map_bench_run<concurrent_skiplist_map_bench_locked>(
+            "mutex + ft::map" + tag, t, keys, ops);
+        concurrent_skiplist_map_bench_run<
+            ft::concurrent_skiplist_map<int, int> >(
+            "ft::concurrent_skiplist_map" + tag, t, keys, ops);
+    }
+}
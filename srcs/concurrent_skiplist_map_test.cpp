@@ -0,0 +1,148 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <pthread.h>
+
+#include <concurrent_skiplist_map.hpp>
+#include <map.hpp>
+
+typedef ft::concurrent_skiplist_map<int, int> concurrent_skiplist_map_test_t;
+
+struct concurrent_skiplist_map_test_job {
+    concurrent_skiplist_map_test_t  *map;
+    int                             id;
+    bool                            sorted;
+};
+
+//Thread id owns the keys k with k % 4 == id and leaves those with
+//k % 8 < 4 in the map. Meanwhile it walks the map, which has to stay
+//sorted.
+static void *concurrent_skiplist_map_test_worker(void *arg)
+{
+    concurrent_skiplist_map_test_job *job
+        = static_cast<concurrent_skiplist_map_test_job *>(arg);
+    concurrent_skiplist_map_test_t &map = *job->map;
+
+    job->sorted = true;
+    for (int round = 0; round < 4; round++)
+    {
+        for (int k = job->id; k < 4000; k += 4)
+            map.insert(ft::make_pair(k, k * 10));
+        for (int k = job->id; k < 4000; k += 4)
+            if (k % 8 >= 4 || round < 3)
+                map.erase(k);
+        int last = -1;
+        for (concurrent_skiplist_map_test_t::iterator it = map.begin();
+            it != map.end(); ++it)
+        {
+            job->sorted = job->sorted && it->first > last
+                && it->second == it->first * 10;
+            last = it->first;
+        }
+        for (int k = 0; k < 4000; k += 7)
+            map.lower_bound(k);
+    }
+    return NULL;
+}
+
+static bool concurrent_skiplist_map_test_threads(void)
+{
+    const int                           threads = 4;
+    concurrent_skiplist_map_test_t      map;
+    concurrent_skiplist_map_test_job    jobs[threads];
+    pthread_t                           ids[threads];
+    bool                                ok = true;
+    int                                 expect = 0;
+
+    for (int t = 0; t < threads; t++)
+    {
+        jobs[t].map = &map;
+        jobs[t].id = t;
+        pthread_create(&ids[t], NULL, concurrent_skiplist_map_test_worker,
+            &jobs[t]);
+    }
+    for (int t = 0; t < threads; t++)
+    {
+        pthread_join(ids[t], NULL);
+        ok = ok && jobs[t].sorted;
+    }
+    for (concurrent_skiplist_map_test_t::iterator it = map.begin();
+        it != map.end(); ++it, expect++)
+    {
+        while (expect % 8 >= 4)
+            expect++;
+        ok = ok && it->first == expect;
+    }
+    ft::epoch_domain::instance().reclaim();
+    return ok && expect == 3996 && map.size() == 2000;
+}
+
+void    concurrent_skiplist_map_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::CONCURRENT_SKIPLIST_MAP: insert / find / erase"
+        << std::endl;
+    ft::concurrent_skiplist_map<std::string, int> words;
+    std::cout << "empty: " << words.empty() << std::endl;
+    words.insert(ft::make_pair(std::string("pear"), 4));
+    words.insert(ft::make_pair(std::string("apple"), 5));
+    words.insert(ft::make_pair(std::string("fig"), 3));
+    ft::pair<ft::concurrent_skiplist_map<std::string, int>::iterator, bool> res
+        = words.insert(ft::make_pair(std::string("fig"), 99));
+    std::cout << "insert existing fig: " << res.second << ", value: "
+        << res.first->second << ", size: " << words.size() << std::endl;
+    for (ft::concurrent_skiplist_map<std::string, int>::iterator it
+        = words.begin(); it != words.end(); ++it)
+        std::cout << it->first << "=" << it->second << " ";
+    std::cout << std::endl;
+    std::cout << "find(pear): " << words.find("pear")->second
+        << ", count(kiwi): " << words.count("kiwi")
+        << ", lower_bound(b): " << words.lower_bound("b")->first
+        << ", upper_bound(fig): " << words.upper_bound("fig")->first
+        << std::endl;
+    std::cout << "erase(fig): " << words.erase("fig") << ", again: "
+        << words.erase("fig") << ", size: " << words.size() << std::endl;
+    ft::concurrent_skiplist_map<std::string, int>::iterator held
+        = words.find("apple");
+    words.erase("apple");
+    std::cout << "iterator to an erased key still reads: " << held->first
+        << ", ++ goes to " << (++held)->first << std::endl;
+    words.clear();
+    std::cout << "after clear: " << words.empty() << " " << words.size()
+        << std::endl;
+
+    ft::concurrent_skiplist_map<int, int> ints;
+    ft::map<int, int> ref;
+    bool ok = true;
+    srand(47);
+    for (int i = 0; i < 20000; i++)
+    {
+        int k = rand() % 5000;
+        if (rand() % 3)
+            ok = ok && ints.insert(ft::make_pair(k, i)).second
+                == ref.insert(ft::make_pair(k, i)).second;
+        else
+            ok = ok && ints.erase(k) == ref.erase(k);
+    }
+    ft::map<int, int>::iterator rit = ref.begin();
+    for (ft::concurrent_skiplist_map<int, int>::iterator it = ints.begin();
+        it != ints.end(); ++it, ++rit)
+        ok = ok && rit != ref.end() && it->first == rit->first
+            && it->second == rit->second;
+    ok = ok && rit == ref.end() && ints.size() == ref.size();
+    for (int k = 0; k < 5000; k += 13)
+        ok = ok && (ints.lower_bound(k) == ints.end()
+            ? ref.lower_bound(k) == ref.end()
+            : ints.lower_bound(k)->first == ref.lower_bound(k)->first);
+    std::cout << "20000 random inserts and erases match ft::map: " << ok
+        << std::endl;
+
+    std::cout << "### FT::CONCURRENT_SKIPLIST_MAP: 4 threads" << std::endl;
+    std::cout << "sorted while changing, right keys at the end: "
+        << concurrent_skiplist_map_test_threads() << std::endl;
+    std::cout << std::endl;
+}
@@ -0,0 +1,109 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <pthread.h>
+#include <unistd.h>
+#include <concurrent_stack.hpp>
+#include <stack.hpp>
+
+//The baseline: ft::stack behind one mutex.
+struct concurrent_stack_bench_locked {
+    pthread_mutex_t lock;
+    ft::stack<int>  stack;
+
+    concurrent_stack_bench_locked(void) { pthread_mutex_init(&lock, NULL); }
+    ~concurrent_stack_bench_locked(void) { pthread_mutex_destroy(&lock); }
+
+    void push(int val)
+    {
+        pthread_mutex_lock(&lock);
+        stack.push(val);
+        pthread_mutex_unlock(&lock);
+    }
+
+    bool try_pop(int &val)
+    {
+        bool ok;
+
+        pthread_mutex_lock(&lock);
+        ok = !stack.empty();
+        if (ok)
+        {
+            val = stack.top();
+            stack.pop();
+        }
+        pthread_mutex_unlock(&lock);
+        return ok;
+    }
+};
+
+//Pairs of push and pop on a shared stack, the most contended pattern.
+template<typename Stack>
+struct concurrent_stack_bench_job {
+    Stack   *stack;
+    size_t  ops;
+    size_t  sum;
+
+    void run(void)
+    {
+        int val;
+
+        for (size_t i = 0; i < ops; i++)
+        {
+            stack->push(static_cast<int>(i));
+            if (stack->try_pop(val))
+                sum += val;
+        }
+    }
+};
+
+template<typename Stack>
+static void concurrent_stack_bench_run(const std::string &name, Stack &stack,
+    size_t threads, size_t ops)
+{
+    ft::vector<concurrent_stack_bench_job<Stack> >  jobs(threads);
+    size_t                                          sum = 0;
+    double                                          sec;
+
+    for (size_t t = 0; t < threads; t++)
+    {
+        jobs[t].stack = &stack;
+        jobs[t].ops = ops / threads;
+        jobs[t].sum = 0;
+    }
+    sec = bench_threads(jobs);
+    for (size_t t = 0; t < threads; t++)
+        sum += jobs[t].sum;
+    bench_report(name, 2 * ops, sec, 0);
+    bench_keep(sum);
+}
+
+void    concurrent_stack_bench(void)
+{
+    const size_t    ops = 1 << 22;
+    long            cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t          max_threads = cpus > 4 ? cpus : 4;
+
+    std::cout << "### concurrent stack, " << ops << " push + pop pairs, "
+        << cpus << " online CPUs" << std::endl;
+    for (size_t t = 1; t <= max_threads; t *= 2)
+    {
+        std::string tag = bench_thread_tag(t);
+        {
+            concurrent_stack_bench_locked stack;
+            concurrent_stack_bench_run("mutex + ft::stack" + tag, stack, t,
+                ops);
+        }
+        {
+            ft::concurrent_stack<int> stack(ft::stack_plain);
+            concurrent_stack_bench_run("ft::concurrent_stack" + tag, stack, t,
+                ops);
+        }
+        {
+            ft::concurrent_stack<int> stack(ft::stack_elimination);
+            concurrent_stack_bench_run("ft::concurrent_stack elimination"
+                + tag, stack, t, ops);
+        }
+    }
+}
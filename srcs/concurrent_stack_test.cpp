@@ -0,0 +1,100 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+#include <concurrent_stack.hpp>
+
+struct concurrent_stack_test_job {
+    ft::concurrent_stack<int>   *stack;
+    int                         first;
+    int                         count;
+    std::vector<int>            popped;
+};
+
+//Pushes count distinct values and pops after every second push, then
+//drains: every value has to come out exactly once over all threads.
+static void *concurrent_stack_test_worker(void *arg)
+{
+    concurrent_stack_test_job *job
+        = static_cast<concurrent_stack_test_job *>(arg);
+    int val;
+
+    for (int i = 0; i < job->count; i++)
+    {
+        job->stack->push(job->first + i);
+        if (i % 2 && job->stack->try_pop(val))
+            job->popped.push_back(val);
+    }
+    while (job->stack->try_pop(val))
+        job->popped.push_back(val);
+    return NULL;
+}
+
+static bool concurrent_stack_test_threads(ft::concurrent_stack_mode mode)
+{
+    const int                   threads = 4;
+    const int                   count = 20000;
+    ft::concurrent_stack<int>   stack(mode);
+    concurrent_stack_test_job   jobs[threads];
+    pthread_t                   ids[threads];
+    std::vector<int>            seen(threads * count, 0);
+    bool                        ok = true;
+
+    for (int t = 0; t < threads; t++)
+    {
+        jobs[t].stack = &stack;
+        jobs[t].first = t * count;
+        jobs[t].count = count;
+        pthread_create(&ids[t], NULL, concurrent_stack_test_worker, &jobs[t]);
+    }
+    for (int t = 0; t < threads; t++)
+        pthread_join(ids[t], NULL);
+    for (int t = 0; t < threads; t++)
+        for (size_t i = 0; i < jobs[t].popped.size(); i++)
+            seen[jobs[t].popped[i]]++;
+    for (size_t i = 0; i < seen.size(); i++)
+        ok = ok && seen[i] == 1;
+    return ok && stack.empty();
+}
+
+void    concurrent_stack_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::CONCURRENT_STACK: push / try_pop" << std::endl;
+    ft::concurrent_stack<std::string> words;
+    std::string word;
+    std::cout << "empty: " << words.empty() << ", try_pop: "
+        << words.try_pop(word) << std::endl;
+    words.push("one");
+    words.push("two");
+    words.push("three");
+    std::cout << "order:";
+    while (words.try_pop(word))
+        std::cout << " " << word;
+    std::cout << std::endl;
+    ft::concurrent_stack<int> ints;
+    for (int i = 0; i < 1000; i++)
+        ints.push(i);
+    bool ok = true;
+    int val;
+    for (int i = 999; i >= 0; i--)
+        ok = ok && ints.try_pop(val) && val == i;
+    for (int i = 0; i < 1000; i++)
+        ints.push(i);
+    for (int i = 999; i >= 0; i--)
+        ok = ok && ints.try_pop(val) && val == i;
+    std::cout << "1000 pushes and pops through the pool, LIFO: " << ok
+        << std::endl;
+
+    std::cout << "### FT::CONCURRENT_STACK: 4 threads" << std::endl;
+    std::cout << "plain, every value popped once: "
+        << concurrent_stack_test_threads(ft::stack_plain) << std::endl;
+    std::cout << "elimination, every value popped once: "
+        << concurrent_stack_test_threads(ft::stack_elimination) << std::endl;
+    std::cout << std::endl;
+}
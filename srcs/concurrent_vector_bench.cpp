@@ -0,0 +1,103 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <pthread.h>
+#include <unistd.h>
+#include <concurrent_vector.hpp>
+
+//The baseline: ft::vector behind one global mutex.
+struct concurrent_vector_bench_locked {
+    pthread_mutex_t lock;
+    ft::vector<int> vec;
+
+    concurrent_vector_bench_locked(void) { pthread_mutex_init(&lock, NULL); }
+    ~concurrent_vector_bench_locked(void) { pthread_mutex_destroy(&lock); }
+
+    size_t push_back(int val)
+    {
+        pthread_mutex_lock(&lock);
+        size_t i = vec.size();
+        vec.push_back(val);
+        pthread_mutex_unlock(&lock);
+        return i;
+    }
+
+    size_t grow_by(const int *first, const int *last)
+    {
+        pthread_mutex_lock(&lock);
+        size_t i = vec.size();
+        vec.insert(vec.end(), first, last);
+        pthread_mutex_unlock(&lock);
+        return i;
+    }
+};
+
+//Appends ops values, one push_back at a time or grow_by batches.
+template<typename Vector>
+struct concurrent_vector_bench_job {
+    Vector  *vec;
+    size_t  ops;
+    size_t  batch;
+    size_t  last;
+
+    void run(void)
+    {
+        int items[64];
+
+        for (size_t i = 0; i < batch; i++)
+            items[i] = static_cast<int>(i);
+        for (size_t i = 0; i < ops; i += batch)
+        {
+            if (batch == 1)
+                last = vec->push_back(static_cast<int>(i));
+            else
+                last = vec->grow_by(items, items + batch);
+        }
+    }
+};
+
+template<typename Vector>
+static void concurrent_vector_bench_run(const std::string &name,
+    size_t threads, size_t batch, size_t ops)
+{
+    Vector                                          vec;
+    ft::vector<concurrent_vector_bench_job<Vector> > jobs(threads);
+    size_t                                          last = 0;
+    double                                          sec;
+
+    for (size_t t = 0; t < threads; t++)
+    {
+        jobs[t].vec = &vec;
+        jobs[t].ops = ops / threads;
+        jobs[t].batch = batch;
+        jobs[t].last = 0;
+    }
+    sec = bench_threads(jobs);
+    for (size_t t = 0; t < threads; t++)
+        last += jobs[t].last;
+    bench_report(name, ops, sec, 0);
+    bench_keep(last);
+}
+
+void    concurrent_vector_bench(void)
+{
+    const size_t    ops = 1 << 21;
+    long            cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t          max_threads = cpus > 4 ? cpus : 4;
+
+    std::cout << "### concurrent vector, " << ops << " appends, " << cpus
+        << " online CPUs" << std::endl;
+    for (size_t batch = 1; batch <= 64; batch *= 64)
+    {
+        for (size_t t = 1; t <= max_threads; t *= 2)
+        {
+            std::string tag = (batch == 1 ? " push_back" : " grow_by 64")
+                + bench_thread_tag(t);
+            concurrent_vector_bench_run<concurrent_vector_bench_locked>(
+                "mutex + ft::vector" + tag, t, batch, ops);
+            concurrent_vector_bench_run<ft::concurrent_vector<int> >(
+                "ft::concurrent_vector" + tag, t, batch, ops);
+        }
+    }
+}
@@ -0,0 +1,112 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+#include <concurrent_vector.hpp>
+
+struct concurrent_vector_test_job {
+    ft::concurrent_vector<int>  *vec;
+    int                         id;
+    bool                        readable;
+};
+
+//Thread id appends id * 100000 + 0 .. 19999, one by one and in batches,
+//and reads back the ready prefix while the others append.
+static void *concurrent_vector_test_worker(void *arg)
+{
+    concurrent_vector_test_job *job
+        = static_cast<concurrent_vector_test_job *>(arg);
+    int batch[10];
+
+    job->readable = true;
+    for (int i = 0; i < 20000;)
+    {
+        if (i % 1000 < 500)
+        {
+            job->vec->push_back(job->id * 100000 + i++);
+            continue;
+        }
+        for (int j = 0; j < 10; j++)
+            batch[j] = job->id * 100000 + i + j;
+        job->vec->grow_by(batch, batch + 10);
+        i += 10;
+        size_t n = job->vec->size();
+        job->readable = job->readable && (*job->vec)[n - 1] % 100000 < 20000;
+    }
+    return NULL;
+}
+
+static bool concurrent_vector_test_threads(void)
+{
+    const int                   threads = 4;
+    ft::concurrent_vector<int>  vec;
+    concurrent_vector_test_job  jobs[threads];
+    pthread_t                   ids[threads];
+    std::vector<int>            next(threads, 0);
+    bool                        ok = true;
+
+    for (int t = 0; t < threads; t++)
+    {
+        jobs[t].vec = &vec;
+        jobs[t].id = t;
+        pthread_create(&ids[t], NULL, concurrent_vector_test_worker, &jobs[t]);
+    }
+    for (int t = 0; t < threads; t++)
+    {
+        pthread_join(ids[t], NULL);
+        ok = ok && jobs[t].readable;
+    }
+    //Each thread's values show up in the order it appended them.
+    ft::vector<int> all = vec.compact();
+    for (size_t i = 0; i < all.size(); i++)
+    {
+        int t = all[i] / 100000;
+        ok = ok && all[i] % 100000 == next[t];
+        next[t]++;
+    }
+    return ok && all.size() == 80000 && vec.size() == 80000;
+}
+
+void    concurrent_vector_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::CONCURRENT_VECTOR: push_back / grow_by / compact"
+        << std::endl;
+    ft::concurrent_vector<std::string> words;
+    std::cout << "empty: " << words.empty() << ", push_back returns "
+        << words.push_back("zero") << " then " << words.push_back("one")
+        << std::endl;
+    std::string more[] = {"two", "three"};
+    std::cout << "grow_by(range) at " << words.grow_by(more, more + 2)
+        << ", grow_by(2, x) at " << words.grow_by(2, "x") << ", size: "
+        << words.size() << std::endl;
+    std::string &first = words[0];
+    for (int i = 0; i < 1000; i++)
+        words.push_back("filler");
+    std::cout << "reference kept across 1000 appends: " << first << ", at(3): "
+        << words.at(3) << std::endl;
+    try
+    {
+        words.at(words.size());
+    }
+    catch (std::out_of_range &e)
+    {
+        std::cout << "at(size()): " << e.what() << std::endl;
+    }
+    ft::vector<std::string> flat = words.compact();
+    std::cout << "compact: " << flat.size() << " " << flat[1] << " "
+        << flat[5] << " " << flat.back() << std::endl;
+    ft::concurrent_vector<int> ints;
+    std::cout << "grow_by(5, 7) is n copies: " << ints.grow_by(5, 7) << " "
+        << ints.size() << " " << ints[4] << std::endl;
+
+    std::cout << "### FT::CONCURRENT_VECTOR: 4 threads" << std::endl;
+    std::cout << "every value once, in order per thread: "
+        << concurrent_vector_test_threads() << std::endl;
+    std::cout << std::endl;
+}
@@ -0,0 +1,51 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <stack.hpp>
+#include <vector.hpp>
+#include <deque.hpp>
+
+struct Record128
+{
+    int     idx;
+    char    payload[124];
+};
+
+//Pushes count records and reports the mean and the worst single push.
+template<typename Stack>
+void    deque_bench_run(const std::string &name, int count)
+{
+    Stack   s;
+    Record128 rec;
+    double  worst = 0;
+    double  start = bench_now();
+    size_t  allocs = bench_allocs();
+
+    rec.idx = 0;
+    for (int i = 0; i < count; i++)
+    {
+        double t = bench_now();
+        rec.idx = i;
+        s.push(rec);
+        t = bench_now() - t;
+        if (t > worst)
+            worst = t;
+    }
+    bench_report(name, count, bench_now() - start, bench_allocs() - allocs);
+    std::cout << "    worst push: " << worst * 1e6 << " us" << std::endl;
+    bench_keep(s.top().idx);
+}
+
+void    deque_bench(void)
+{
+    const int   count = 4 * 1024 * 1024;
+
+    std::cout << "### stack growth: " << count << " pushes of 128 bytes"
+        << std::endl;
+    deque_bench_run<ft::stack<Record128, ft::vector<Record128> > >(
+        "ft::stack<Record128, ft::vector>", count);
+    deque_bench_run<ft::stack<Record128, ft::deque<Record128> > >(
+        "ft::stack<Record128, ft::deque>", count);
+    std::cout << std::endl;
+}
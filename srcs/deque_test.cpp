@@ -0,0 +1,81 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <deque.hpp>
+
+template<typename T>
+void    printDeque(T &d, std::string name)
+{
+    std::cout << name << " (" << d.size() << "):\t";
+    for (typename T::iterator it = d.begin(); it != d.end(); ++it)
+        std::cout << *it << ", ";
+    std::cout << std::endl;
+}
+
+void    deque_test(void)
+{
+    std::cout << "### FT::DEQUE: push_front / push_back" << std::endl;
+    ft::deque<int> d;
+    for (int i = 0; i < 5; i++)
+    {
+        d.push_back(i);
+        d.push_front(-i - 1);
+    }
+    printDeque(d, "d");
+    std::cout << "front: " << d.front() << ", back: " << d.back()
+        << ", d[3]: " << d[3] << std::endl;
+
+    std::cout << "### FT::DEQUE: references stay valid while growing" << std::endl;
+    int &first = d.front();
+    int *addr = &first;
+    for (int i = 0; i < 100000; i++)
+    {
+        d.push_back(i);
+        d.push_front(i);
+    }
+    std::cout << "same address: " << std::boolalpha << (addr == &first)
+        << ", value: " << first << ", size: " << d.size() << std::endl;
+    while (d.size() > 6)
+    {
+        d.pop_back();
+        d.pop_front();
+    }
+    printDeque(d, "d");
+
+    std::cout << "### FT::DEQUE: insert / erase" << std::endl;
+    d.insert(d.begin() + 1, 2, 100);
+    d.insert(d.end() - 1, 200);
+    printDeque(d, "d");
+    d.erase(d.begin() + 1, d.begin() + 3);
+    d.erase(d.end() - 2);
+    printDeque(d, "d");
+
+    std::cout << "### FT::DEQUE: copy, compare, reverse, at" << std::endl;
+    ft::deque<std::string> ds(3, "abc");
+    ft::deque<std::string> ds2(ds);
+    ds2.push_front("zz");
+    std::cout << "ds == ds2: " << (ds == ds2) << ", ds < ds2: " << (ds < ds2)
+        << std::endl;
+    std::cout << "reverse ds2:\t";
+    for (ft::deque<std::string>::reverse_iterator rit = ds2.rbegin();
+        rit != ds2.rend(); ++rit)
+        std::cout << *rit << ", ";
+    std::cout << std::endl;
+    try
+    {
+        ds.at(3);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+    ds.swap(ds2);
+    printDeque(ds, "ds");
+    ds.clear();
+    std::cout << "ds after clear: " << ds.size() << std::endl << std::endl;
+}
@@ -0,0 +1,48 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <vector.hpp>
+#include <devector.hpp>
+
+void    devector_bench(void)
+{
+    const int   count = 50000;
+    const int   window = 4096;
+    const int   slides = 2000000;
+    double      start;
+
+    std::cout << "### front insertion: " << count << " elements" << std::endl;
+    {
+        ft::vector<int> v;
+        start = bench_now();
+        for (int i = 0; i < count; i++)
+            v.insert(v.begin(), i);
+        bench_report("ft::vector::insert(begin())", count, bench_now() - start, 0);
+        bench_keep(v.front());
+    }
+    {
+        ft::devector<int> v;
+        start = bench_now();
+        for (int i = 0; i < count; i++)
+            v.push_front(i);
+        bench_report("ft::devector::push_front", count, bench_now() - start, 0);
+        bench_keep(v.front());
+    }
+
+    std::cout << "### prepending window of " << window << " ints" << std::endl;
+    {
+        ft::devector<int> v(window, 0);
+        size_t allocs = bench_allocs();
+        start = bench_now();
+        for (int i = 0; i < slides; i++)
+        {
+            v.push_front(i);
+            v.pop_back();
+        }
+        bench_report("ft::devector push_front + pop_back", slides,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(v.front());
+    }
+    std::cout << std::endl;
+}
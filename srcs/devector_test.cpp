@@ -0,0 +1,77 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <devector.hpp>
+
+template<typename T>
+void    printDevec(T &v, std::string name)
+{
+    std::cout << name << " (front free: " << v.front_free_capacity()
+        << ", back free: " << v.back_free_capacity() << "):\t";
+    for (size_t i = 0; i < v.size(); i++)
+        std::cout << "[" << i << "]:  " << v[i] << ",   ";
+    std::cout << std::endl;
+}
+
+void    devector_test(void)
+{
+    std::cout << "### FT::DEVECTOR: push_front / push_back" << std::endl;
+    ft::devector<std::string> v;
+    v.push_back("c");
+    v.push_front("b");
+    v.push_front("a");
+    v.push_back("d");
+    printDevec(v, "v");
+
+    std::cout << "### FT::DEVECTOR: insert / erase on the shorter side" << std::endl;
+    v.insert(v.begin() + 1, 2, "x");
+    v.insert(v.end() - 1, "y");
+    printDevec(v, "v");
+    v.erase(v.begin() + 1, v.begin() + 3);
+    v.erase(v.end() - 2);
+    printDevec(v, "v");
+
+    std::cout << "### FT::DEVECTOR: pop_front / pop_back" << std::endl;
+    v.pop_front();
+    v.pop_back();
+    printDevec(v, "v");
+
+    std::cout << "### FT::DEVECTOR: ft::vector iterators" << std::endl;
+    ft::vector<std::string>::iterator it = v.begin();
+    ft::vector<std::string> copy(it, v.end());
+    std::cout << "copy size: " << copy.size() << ", front: " << copy.front()
+        << ", it[1]: " << it[1] << std::endl;
+
+    std::cout << "### FT::DEVECTOR: sliding window keeps its capacity" << std::endl;
+    ft::devector<int> w;
+    for (int i = 0; i < 16; i++)
+        w.push_back(i);
+    size_t cap = w.capacity();
+    for (int i = 16; i < 100000; i++)
+    {
+        w.push_back(i);
+        w.pop_front();
+    }
+    std::cout << "size: " << w.size() << ", front: " << w.front()
+        << ", capacity grew: " << std::boolalpha << (w.capacity() > cap * 2)
+        << std::endl;
+
+    std::cout << "### FT::DEVECTOR: copy, compare, at" << std::endl;
+    ft::devector<int> w2(w);
+    w2.push_front(0);
+    std::cout << "w == w2: " << (w == w2) << ", w2 < w: " << (w2 < w) << std::endl;
+    try
+    {
+        w.at(16);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,74 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <algorithm>
+#include <vector.hpp>
+#include <incremental_vector.hpp>
+
+struct BenchTick
+{
+    long    id;
+    char    payload[56];
+};
+
+//Times every push_back on its own and prints the median, the 99.99th
+//percentile and the worst one, which is where doubling hurts.
+template<typename Vector>
+void    incremental_vector_bench_tail(const std::string &name, size_t count)
+{
+    Vector v;
+    ft::vector<double> lat(count);
+    BenchTick tick = {0, {0}};
+    double start;
+    double t;
+
+    start = bench_now();
+    for (size_t i = 0; i < count; i++)
+    {
+        tick.id = i;
+        t = bench_now();
+        v.push_back(tick);
+        lat[i] = bench_now() - t;
+    }
+    start = bench_now() - start;
+    std::sort(lat.begin(), lat.end());
+    std::cout << std::left << std::setw(48) << name << std::right
+        << std::fixed << std::setprecision(0)
+        << "p50 " << lat[count / 2] * 1e9 << " ns, p99.99 "
+        << lat[count - count / 10000] * 1e9 << " ns, max "
+        << lat[count - 1] * 1e6 << " us, total "
+        << start * 1e3 << " ms" << std::endl;
+    bench_keep(v.size());
+}
+
+void    incremental_vector_bench(void)
+{
+    const size_t    count = 1 << 23;
+    BenchTick       tick = {0, {0}};
+    double          start;
+    long            sum;
+
+    std::cout << "### push_back latency, " << count << " 64-byte elements"
+        << std::endl;
+    incremental_vector_bench_tail<ft::vector<BenchTick> >(
+        "ft::vector::push_back", count);
+    incremental_vector_bench_tail<ft::incremental_vector<BenchTick> >(
+        "ft::incremental_vector::push_back", count);
+    {
+        ft::incremental_vector<BenchTick> v;
+        for (size_t i = 0; i < count; i++)
+        {
+            tick.id = i;
+            v.push_back(tick);
+        }
+        sum = 0;
+        start = bench_now();
+        for (size_t i = 0; i < count; i++)
+            sum += v[i].id;
+        bench_report("ft::incremental_vector::operator[] scan", count,
+            bench_now() - start, 0);
+        bench_keep(sum);
+    }
+    std::cout << std::endl;
+}
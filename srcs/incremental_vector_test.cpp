@@ -0,0 +1,79 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <incremental_vector.hpp>
+
+template<typename T>
+static void print_incremental_vector(const ft::incremental_vector<T> &v)
+{
+    for (typename ft::incremental_vector<T>::const_iterator it = v.begin();
+        it != v.end(); ++it)
+        std::cout << *it << " ";
+    std::cout << "(size: " << v.size() << ", capacity: " << v.capacity()
+        << ", migrating: " << v.migrating() << ")" << std::endl;
+}
+
+void    incremental_vector_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::INCREMENTAL_VECTOR: indexing during a migration"
+        << std::endl;
+    ft::incremental_vector<int> v;
+    for (int i = 0; i < 9; i++)
+        v.push_back(i);
+    print_incremental_vector(v);
+    v.push_back(v[2]);
+    print_incremental_vector(v);
+    v.pop_back();
+    v.pop_back();
+    v.pop_back();
+    print_incremental_vector(v);
+    v.reserve(64);
+    std::cout << "front: " << v.front() << ", back: " << v.back()
+        << ", at(3): " << v.at(3) << ", *(end() - 2): " << *(v.end() - 2)
+        << std::endl;
+    print_incremental_vector(v);
+    v.finish_migration();
+    print_incremental_vector(v);
+
+    std::cout << "### FT::INCREMENTAL_VECTOR: iterators survive growth"
+        << std::endl;
+    ft::incremental_vector<std::string> s;
+    s.push_back("first");
+    ft::incremental_vector<std::string>::iterator it = s.begin();
+    for (int i = 0; i < 1000; i++)
+        s.push_back(std::string(20, 'a' + i % 26));
+    std::cout << "*it: " << *it << ", it->size(): " << it->size()
+        << ", s[1000]: " << s[1000] << std::endl;
+    bool ok = true;
+    for (int i = 0; i < 1000; i++)
+        ok = ok && s[i + 1] == std::string(20, 'a' + i % 26);
+    std::cout << "contents kept: " << ok << std::endl;
+
+    std::cout << "### FT::INCREMENTAL_VECTOR: copy / swap / compare / resize"
+        << std::endl;
+    ft::incremental_vector<int> c(v);
+    std::cout << "c == v: " << (c == v) << std::endl;
+    c.resize(10, 42);
+    std::cout << "c > v: " << (c > v) << std::endl;
+    ft::swap(c, v);
+    print_incremental_vector(v);
+    c = v;
+    std::cout << "after c = v, c == v: " << (c == v) << std::endl;
+    c.clear();
+    print_incremental_vector(c);
+    try
+    {
+        c.at(0);
+    }
+    catch (std::out_of_range &e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,83 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <cstdio>
+#include <mapped_vector.hpp>
+
+struct BenchRecord
+{
+    long    key;
+    double  value;
+};
+
+void    mapped_vector_bench(void)
+{
+    const char      *path = "/tmp/ft_mapped_vector_bench.bin";
+    const size_t    count = 1 << 24;
+    double          start;
+    size_t          allocs;
+    double          sum;
+
+    std::cout << "### loading " << count << " records ("
+        << (count * sizeof(BenchRecord) >> 20) << " MB) at startup" << std::endl;
+    {
+        ft::mapped_vector<BenchRecord> out(path,
+            ft::mapped_vector<BenchRecord>::read_write);
+        out.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            BenchRecord r = {static_cast<long>(i), i * 0.5};
+            out.push_back(r);
+        }
+    }
+    {
+        ft::vector<BenchRecord> v;
+        BenchRecord r;
+        FILE *f = fopen(path, "rb");
+        allocs = bench_allocs();
+        start = bench_now();
+        while (f && fread(&r, sizeof(r), 1, f) == 1)
+            v.push_back(r);
+        bench_report("fread + ft::vector::push_back", count,
+            bench_now() - start, bench_allocs() - allocs);
+        if (f)
+            fclose(f);
+        bench_keep(v.size());
+    }
+    {
+        ft::vector<BenchRecord> v;
+        int fd = open(path, O_RDONLY);
+        ssize_t got;
+        allocs = bench_allocs();
+        start = bench_now();
+        while ((got = read(fd, v.prepare(1 << 16), (1 << 16) * sizeof(BenchRecord))) > 0)
+            v.commit(got / sizeof(BenchRecord));
+        bench_report("read into ft::vector::prepare", count,
+            bench_now() - start, bench_allocs() - allocs);
+        close(fd);
+        bench_keep(v.size());
+    }
+    {
+        allocs = bench_allocs();
+        start = bench_now();
+        ft::mapped_vector<BenchRecord> m(path);
+        bench_report("ft::mapped_vector open", count,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(m.size());
+    }
+    {
+        start = bench_now();
+        ft::mapped_vector<BenchRecord> m(path);
+        m.advise(ft::mapped_vector<BenchRecord>::sequential);
+        sum = 0;
+        for (ft::mapped_vector<BenchRecord>::const_iterator it = m.begin();
+            it != m.end(); ++it)
+            sum += it->value;
+        bench_report("ft::mapped_vector open + first full scan", count,
+            bench_now() - start, 0);
+        bench_keep(static_cast<size_t>(sum));
+    }
+    std::remove(path);
+    std::cout << std::endl;
+}
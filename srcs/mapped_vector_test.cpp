@@ -0,0 +1,109 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdio>
+
+#include <mapped_vector.hpp>
+
+struct Record
+{
+    int     id;
+    double  value;
+};
+
+void    printRecords(const ft::mapped_vector<Record> &v, std::string name)
+{
+    std::cout << name << " (" << v.size() << "):\t";
+    for (ft::mapped_vector<Record>::const_iterator it = v.begin();
+        it != v.end(); ++it)
+        std::cout << it->id << "=" << it->value << ", ";
+    std::cout << std::endl;
+}
+
+void    mapped_vector_test(void)
+{
+    const char  *path = "/tmp/ft_mapped_vector_test.bin";
+    std::remove(path);
+
+    std::cout << "### FT::MAPPED_VECTOR: read_write grows the file" << std::endl;
+    {
+        ft::mapped_vector<Record> rw(path, ft::mapped_vector<Record>::read_write);
+        for (int i = 0; i < 5; i++)
+        {
+            Record r = {i, i * 1.5};
+            rw.push_back(r);
+        }
+        rw.pop_back();
+        rw.sync();
+        std::cout << "size: " << rw.size() << ", capacity >= size: "
+            << std::boolalpha << (rw.capacity() >= rw.size()) << std::endl;
+        printRecords(rw, "rw");
+    }
+
+    std::cout << "### FT::MAPPED_VECTOR: read_only sees the trimmed file" << std::endl;
+    ft::mapped_vector<Record> ro(path);
+    ro.advise(ft::mapped_vector<Record>::sequential);
+    printRecords(ro, "ro");
+    std::cout << "ro.at(3).id: " << ro.at(3).id << ", rbegin: "
+        << ro.rbegin()->id << std::endl;
+    try
+    {
+        ro.at(4);
+    }
+    catch (std::out_of_range &e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+    try
+    {
+        Record r = {9, 9};
+        ro.push_back(r);
+    }
+    catch (std::logic_error &e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+
+    std::cout << "### FT::MAPPED_VECTOR: copy_on_write stays private" << std::endl;
+    {
+        ft::mapped_vector<Record> cow(path, ft::mapped_vector<Record>::copy_on_write);
+        cow[0].value = 100;
+        cow.advise(ft::mapped_vector<Record>::random);
+        std::cout << "cow[0]: " << cow[0].value << ", ro[0]: " << ro[0].value
+            << std::endl;
+        std::cout << "advise(dontneed): " << std::boolalpha
+            << cow.advise(ft::mapped_vector<Record>::dontneed)
+            << ", cow[0] kept: " << cow[0].value << std::endl;
+    }
+
+    std::cout << "### FT::MAPPED_VECTOR: resize / reopen" << std::endl;
+    {
+        ft::mapped_vector<Record> rw(path, ft::mapped_vector<Record>::read_write);
+        Record fill = {-1, 0.5};
+        rw.resize(6, fill);
+        rw.resize(5);
+    }
+    ro.open(path);
+    printRecords(ro, "ro");
+    ft::mapped_vector<int> ints(path);
+    ft::mapped_vector<int> same(path);
+    std::cout << "as ints: " << ints.size() << ", ints == same: "
+        << (ints == same) << std::endl;
+    ro.close();
+    std::cout << "closed: is_open: " << ro.is_open() << ", size: " << ro.size()
+        << std::endl;
+    std::remove(path);
+    try
+    {
+        ro.open(path);
+    }
+    catch (std::runtime_error &e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,57 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <cstdlib>
+#include <vector.hpp>
+#include <mmap_allocator.hpp>
+
+//Buffer from main.cpp.
+struct MainBuffer
+{
+    int     idx;
+    char    buff[4096];
+};
+
+//The vector_buffer part of main.cpp: push_back count buffers, then write
+//to count random ones.
+template<typename Allocator>
+void    mmap_allocator_bench_run(const std::string &name, size_t count,
+    const Allocator &alloc)
+{
+    double  start;
+    size_t  allocs;
+
+    ft::vector<MainBuffer, Allocator> v(alloc);
+    allocs = bench_allocs();
+    start = bench_now();
+    for (size_t i = 0; i < count; i++)
+        v.push_back(MainBuffer());
+    bench_report(name + " push_back", count, bench_now() - start,
+        bench_allocs() - allocs);
+    srand(42);
+    start = bench_now();
+    for (size_t i = 0; i < count; i++)
+        v[rand() % count].idx = 5;
+    bench_report(name + " random write", count, bench_now() - start, 0);
+    bench_keep(v[count / 2].idx);
+}
+
+void    mmap_allocator_bench(void)
+{
+    //main.cpp uses 4 GB, which doubles to 8 GB while std::allocator copies.
+    const size_t    count = (size_t(1) << 30) / sizeof(MainBuffer);
+
+    std::cout << "### main.cpp vector_buffer workload, " << count
+        << " x " << sizeof(MainBuffer) << " bytes" << std::endl;
+    mmap_allocator_bench_run("std::allocator", count,
+        std::allocator<MainBuffer>());
+    mmap_allocator_bench_run("ft::mmap_allocator", count,
+        ft::mmap_allocator<MainBuffer>());
+    mmap_allocator_bench_run("ft::mmap_allocator huge", count,
+        ft::mmap_allocator<MainBuffer>(ft::mmap_huge_pages));
+    mmap_allocator_bench_run("ft::mmap_allocator huge+populate", count,
+        ft::mmap_allocator<MainBuffer>(ft::mmap_huge_pages
+            | ft::mmap_populate));
+    std::cout << std::endl;
+}
@@ -0,0 +1,54 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <vector.hpp>
+#include <mmap_allocator.hpp>
+
+void    mmap_allocator_test(void)
+{
+    std::cout << "### FT::MMAP_ALLOCATOR: growth past mmap_threshold"
+        << std::endl;
+    ft::vector<int, ft::mmap_allocator<int> > v(
+        ft::mmap_allocator<int>(ft::mmap_huge_pages | ft::mmap_populate));
+    for (int i = 0; i < 100000; i++)
+        v.push_back(i);
+    bool ok = true;
+    for (int i = 0; i < 100000; i++)
+        ok = ok && v[i] == i;
+    std::cout << "size: " << v.size() << ", capacity: " << v.capacity()
+        << ", contents kept: " << std::boolalpha << ok << std::endl;
+
+    std::cout << "### FT::MMAP_ALLOCATOR: shrink back under the threshold"
+        << std::endl;
+    v.resize(10);
+    v.shrink_to_fit();
+    std::cout << "size: " << v.size() << ", capacity: " << v.capacity()
+        << ", back: " << v.back() << std::endl;
+    v.resize(50000, 7);
+    std::cout << "resize(50000, 7): v[9]: " << v[9] << ", v[49999]: "
+        << v[49999] << std::endl;
+
+    std::cout << "### FT::MMAP_ALLOCATOR: non-trivial elements are copied"
+        << std::endl;
+    ft::vector<std::string, ft::mmap_allocator<std::string> > s;
+    for (int i = 0; i < 10000; i++)
+        s.push_back(std::string(40, 'a' + i % 26));
+    std::cout << "size: " << s.size() << ", s[0]: " << s[0].substr(0, 5)
+        << ", s[9999]: " << s[9999].substr(0, 5) << std::endl;
+
+    std::cout << "### FT::MMAP_ALLOCATOR: direct reallocate" << std::endl;
+    ft::mmap_allocator<char> a(ft::mmap_lock);
+    char *p = a.allocate(1 << 20);
+    p[0] = 'x';
+    p[(1 << 20) - 1] = 'y';
+    p = a.reallocate(p, 1 << 20, 1 << 22);
+    std::cout << "kept: " << p[0] << p[(1 << 20) - 1] << ", new tail: "
+        << static_cast<int>(p[(1 << 22) - 1]) << std::endl;
+    a.deallocate(p, 1 << 22);
+    std::cout << std::endl;
+}
@@ -0,0 +1,59 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <string>
+#include <vector.hpp>
+#include <map.hpp>
+
+//Run once built with -std=c++98 and once with -std=c++11 or later: the
+//C++98 build copies on every reallocation and node insert.
+void    move_bench(void)
+{
+    const int           count = 200000;
+    const int           heavy = 2000;
+    const std::string   str(64, 's');
+    double              start;
+    size_t              allocs;
+
+#if __cplusplus >= 201103L
+    std::cout << "### move semantics (C++11 build)" << std::endl;
+#else
+    std::cout << "### move semantics (C++98 build)" << std::endl;
+#endif
+    {
+        ft::vector<std::string> v;
+        allocs = bench_allocs();
+        start = bench_now();
+        for (int i = 0; i < count; i++)
+            v.push_back(str);
+        bench_report("ft::vector<std::string> growth, 64 chars", count,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(v.size());
+    }
+    {
+        ft::map<int, ft::vector<int> > m;
+        ft::vector<int> val(256, 1);
+        allocs = bench_allocs();
+        start = bench_now();
+        for (int i = 0; i < heavy; i++)
+            m.insert(ft::pair<const int, ft::vector<int> >(i, val));
+        bench_report("ft::map<int, vector<int>(256)>::insert", heavy,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(m.size());
+    }
+#if __cplusplus >= 201103L
+    {
+        ft::map<int, ft::vector<int> > m;
+        ft::vector<int> val(256, 1);
+        allocs = bench_allocs();
+        start = bench_now();
+        for (int i = 0; i < heavy; i++)
+            m.try_emplace(i, val);
+        bench_report("ft::map<int, vector<int>(256)>::try_emplace", heavy,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(m.size());
+    }
+#endif
+    std::cout << std::endl;
+}
@@ -0,0 +1,134 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <vector.hpp>
+#include <map.hpp>
+#include <set.hpp>
+#include <stack.hpp>
+
+#if __cplusplus >= 201103L
+//Counts how often it gets copied and moved.
+struct Tracked
+{
+    static int  copies;
+    static int  moves;
+    std::string s;
+
+    Tracked(void): s() {}
+    Tracked(const std::string &_s): s(_s) {}
+    Tracked(const char *a, const char *b): s(std::string(a) + b) {}
+    Tracked(const Tracked &inst): s(inst.s) {copies++;}
+    Tracked(Tracked &&inst) noexcept: s(std::move(inst.s)) {moves++;}
+    Tracked &operator=(const Tracked &inst) {s = inst.s; copies++; return *this;}
+    Tracked &operator=(Tracked &&inst) noexcept
+    {
+        s = std::move(inst.s);
+        moves++;
+        return *this;
+    }
+
+    static void reset(void) {copies = 0; moves = 0;}
+    static void print(const std::string &name)
+    {
+        std::cout << name << ": copies: " << copies << ", moves: " << moves
+            << std::endl;
+    }
+};
+
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+void    move_test(void)
+{
+    std::cout << "### FT::VECTOR: relocation moves, emplace_back builds in place"
+        << std::endl;
+    ft::vector<Tracked> v;
+    Tracked::reset();
+    for (int i = 0; i < 9; i++)
+        v.emplace_back("e", std::to_string(i).c_str());
+    Tracked::print("9 x emplace_back");
+    Tracked::reset();
+    Tracked t("moved");
+    v.push_back(std::move(t));
+    v.push_back(v[0]);
+    Tracked::print("push_back(move(t)), push_back(v[0])");
+    std::cout << "v[0]: " << v[0].s << ", v[9]: " << v[9].s << ", v[10]: "
+        << v[10].s << ", t: '" << t.s << "'" << std::endl;
+
+    std::cout << "### FT::VECTOR: emplace in the middle" << std::endl;
+    v.emplace(v.begin() + 1, "mid", "dle");
+    v.emplace(v.end(), "last");
+    v.insert(v.begin(), Tracked("first"));
+    for (size_t i = 0; i < v.size(); i++)
+        std::cout << v[i].s << " ";
+    std::cout << std::endl;
+
+    std::cout << "### FT::VECTOR: move constructor / assignment" << std::endl;
+    ft::vector<Tracked> w(std::move(v));
+    std::cout << "w size: " << w.size() << ", v size: " << v.size()
+        << ", v capacity: " << v.capacity() << std::endl;
+    v = std::move(w);
+    std::cout << "v size: " << v.size() << ", w size: " << w.size() << std::endl;
+
+    std::cout << "### FT::MAP: try_emplace / emplace / rvalue insert" << std::endl;
+    ft::map<int, Tracked> m;
+    Tracked::reset();
+    m.try_emplace(1, "one");
+    m.try_emplace(2, "tw", "o");
+    Tracked::print("2 x try_emplace");
+    Tracked::reset();
+    Tracked three("three");
+    std::cout << "try_emplace on existing key inserted: " << std::boolalpha
+        << m.try_emplace(1, std::move(three)).second << std::endl;
+    std::cout << "three still owns its string: " << three.s << std::endl;
+    m.insert(ft::make_pair(3, std::move(three)));
+    m.emplace(4, Tracked("four"));
+    m[5].s = "five";
+    Tracked::print("insert / emplace / operator[]");
+    for (ft::map<int, Tracked>::iterator it = m.begin(); it != m.end(); ++it)
+        std::cout << it->first << ": " << it->second.s << ", ";
+    std::cout << std::endl;
+
+    std::cout << "### FT::MAP: move constructor / assignment" << std::endl;
+    ft::map<int, Tracked> n(std::move(m));
+    std::cout << "n size: " << n.size() << ", m size: " << m.size() << std::endl;
+    m = std::move(n);
+    std::cout << "m size: " << m.size() << ", n size: " << n.size() << std::endl;
+
+    std::cout << "### FT::SET: emplace / move" << std::endl;
+    ft::set<std::string> s;
+    std::string key("key");
+    s.insert(std::move(key));
+    s.emplace(3, 'x');
+    std::cout << "inserted again: " << s.emplace("key").second << std::endl;
+    ft::set<std::string> s2(std::move(s));
+    for (ft::set<std::string>::iterator it = s2.begin(); it != s2.end(); ++it)
+        std::cout << *it << " ";
+    std::cout << "(moved-from size: " << s.size() << ")" << std::endl;
+
+    std::cout << "### FT::STACK: emplace / push(move) / move" << std::endl;
+    ft::stack<Tracked> st;
+    Tracked::reset();
+    st.emplace("a", "b");
+    st.push(Tracked("c"));
+    Tracked::print("emplace + push(rvalue)");
+    ft::stack<Tracked> st2(std::move(st));
+    std::cout << "st2 size: " << st2.size() << ", top: " << st2.top().s
+        << ", st size: " << st.size() << std::endl;
+    ft::stack<int, ft::vector<int> > sv;
+    sv.emplace(42);
+    std::cout << "stack<int, vector<int> > top: " << sv.top() << std::endl;
+    std::cout << std::endl;
+}
+#else
+void    move_test(void)
+{
+    std::cout << "### move semantics: built as C++98, build with STD=c++11"
+        << std::endl << std::endl;
+}
+#endif
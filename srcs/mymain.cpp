@@ -3,17 +3,63 @@
 //
 
 #include "vector_test.cpp"
+#include "vector_bool_test.cpp"
+#include "vector_io_test.cpp"
 #include "stack_test.cpp"
+#include "deque_test.cpp"
 #include "pair_test.cpp"
 #include "rbtree_test.cpp"
 #include "map_test.cpp"
+#include "small_map_test.cpp"
+#include "small_vector_test.cpp"
+#include "devector_test.cpp"
+#include "mapped_vector_test.cpp"
+#include "mmap_allocator_test.cpp"
+#include "stable_vector_test.cpp"
+#include "incremental_vector_test.cpp"
+#include "soa_vector_test.cpp"
+#include "compressed_vector_test.cpp"
+#include "simd_compare_test.cpp"
+#include "par_test.cpp"
+#include "algorithm_test.cpp"
+#include "priority_queue_test.cpp"
+#include "concurrent_stack_test.cpp"
+#include "concurrent_queue_test.cpp"
+#include "concurrent_skiplist_map_test.cpp"
+#include "rcu_map_test.cpp"
+#include "sharded_map_test.cpp"
+#include "concurrent_vector_test.cpp"
+#include "move_test.cpp"
 
 int main(void)
 {
     vector_test();
+    vector_bool_test();
+    vector_io_test();
     stack_test();
+    deque_test();
     pair_test();
     rbtree_test();
     map_test();
+    small_map_test();
+    small_vector_test();
+    devector_test();
+    mapped_vector_test();
+    mmap_allocator_test();
+    stable_vector_test();
+    incremental_vector_test();
+    soa_vector_test();
+    compressed_vector_test();
+    simd_compare_test();
+    par_test();
+    algorithm_test();
+    priority_queue_test();
+    concurrent_stack_test();
+    concurrent_queue_test();
+    concurrent_skiplist_map_test();
+    rcu_map_test();
+    sharded_map_test();
+    concurrent_vector_test();
+    move_test();
     return 0;
 }
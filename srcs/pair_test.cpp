@@ -27,6 +27,10 @@ void    pair_test(void)
     std::cout << "p < p2: " << std::boolalpha << (p < p2) << std::endl;
     std::cout << "p <= p2: " << std::boolalpha << (p <= p2) << std::endl;
     std::cout << "p > p2: " << std::boolalpha << (p > p2) << std::endl;
-    std::cout << "p >= p2: " << std::boolalpha << (p >= p2) << std::endl;
+    std::cout << "p >= p2: " << std::boolalpha << (p >= p2) << std::endl << std::endl;
 
+    std::cout << "pair: init from NULL: ft::pair<const char *, int> p3(NULL, 1)" << std::endl;
+    ft::pair<const char *, int>  p3(NULL, 1);
+    std::cout << "p3.first == NULL: " << std::boolalpha << (p3.first == NULL)
+        << ", p3.second: " << p3.second << std::endl << std::endl;
 }
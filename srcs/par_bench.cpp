@@ -0,0 +1,71 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <par.hpp>
+
+struct par_bench_score {
+    void operator()(double &x) const { x = std::sqrt(x) * 1.5 + 1.0; }
+};
+
+struct par_bench_scale {
+    double operator()(double x) const { return x * 0.5; }
+};
+
+//Strong scaling: the same work split over 1, 2, 4 ... threads.
+void    par_bench(void)
+{
+    const size_t    count = 1 << 24;
+    const size_t    sorted = 1 << 22;
+    long            cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t          max_threads = cpus > 4 ? cpus : 4;
+    ft::vector<double> v(count, 2.0);
+    ft::vector<double> out(count);
+    ft::vector<int> keys(sorted);
+    ft::vector<int> work;
+    double          start;
+    double          sum;
+
+    std::cout << "### ft::par, " << count << " doubles, " << sorted
+        << " ints to sort, " << cpus << " online CPUs" << std::endl;
+    srand(42);
+    for (size_t i = 0; i < sorted; i++)
+        keys[i] = rand();
+    for (size_t t = 1; t <= max_threads; t *= 2)
+    {
+        std::ostringstream tag;
+        tag << ", " << t << " thread" << (t > 1 ? "s" : "");
+        ft::par::set_thread_count(t);
+        start = bench_now();
+        ft::par::for_each(v.begin(), v.end(), par_bench_score());
+        bench_report("ft::par::for_each sqrt" + tag.str(), count,
+            bench_now() - start, 0);
+        start = bench_now();
+        ft::par::transform(v.begin(), v.end(), out.begin(), par_bench_scale());
+        bench_report("ft::par::transform" + tag.str(), count,
+            bench_now() - start, 0);
+        start = bench_now();
+        sum = ft::par::reduce(out.begin(), out.end(), 0.0);
+        bench_report("ft::par::reduce" + tag.str(), count,
+            bench_now() - start, 0);
+        bench_keep(static_cast<size_t>(sum));
+        start = bench_now();
+        ft::par::fill(out.begin(), out.end(), 1.0);
+        bench_report("ft::par::fill" + tag.str(), count,
+            bench_now() - start, 0);
+        start = bench_now();
+        ft::par::copy(v.begin(), v.end(), out.begin());
+        bench_report("ft::par::copy" + tag.str(), count,
+            bench_now() - start, 0);
+        work = keys;
+        start = bench_now();
+        ft::par::sort(work.begin(), work.end());
+        bench_report("ft::par::sort" + tag.str(), sorted,
+            bench_now() - start, 0);
+        bench_keep(work[sorted / 2]);
+    }
+    ft::par::set_thread_count(cpus > 0 ? cpus : 1);
+}
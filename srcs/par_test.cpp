@@ -0,0 +1,98 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+
+#include <par.hpp>
+#include <pair.hpp>
+
+struct par_test_twice {
+    int operator()(int x) const { return 2 * x; }
+};
+
+struct par_test_increment {
+    void operator()(int &x) const { x++; }
+};
+
+struct par_test_max {
+    int operator()(int a, int b) const { return a < b ? b : a; }
+};
+
+struct par_test_by_key {
+    bool operator()(const ft::pair<int, int> &a,
+        const ft::pair<int, int> &b) const { return a.first < b.first; }
+};
+
+void    par_test(void)
+{
+    std::cout << std::boolalpha;
+    ft::par::set_thread_count(4);
+    std::cout << "### FT::PAR: for_each / transform / fill / copy, "
+        << ft::par::thread_count() << " threads" << std::endl;
+    const int n = 100003;
+    ft::vector<int> v(n);
+    for (int i = 0; i < n; i++)
+        v[i] = i;
+    ft::par::for_each(v.begin(), v.end(), par_test_increment());
+    bool ok = true;
+    for (int i = 0; i < n; i++)
+        ok = ok && v[i] == i + 1;
+    std::cout << "for_each: " << ok << std::endl;
+    ft::vector<int> w(n);
+    ft::vector<int>::iterator end = ft::par::transform(v.begin(), v.end(),
+        w.begin(), par_test_twice());
+    ok = end == w.end();
+    for (int i = 0; i < n; i++)
+        ok = ok && w[i] == 2 * (i + 1);
+    std::cout << "transform: " << ok << std::endl;
+    int raw[1000];
+    ft::par::fill(raw, raw + 1000, 7);
+    ft::par::copy(raw, raw + 1000, w.begin() + 10);
+    std::cout << "fill + copy on a raw array: " << (w[9] == 20) << " "
+        << (w[10] == 7) << " " << (w[1009] == 7) << " " << (w[1010] == 2022)
+        << std::endl;
+
+    std::cout << "### FT::PAR: reduce" << std::endl;
+    std::cout << "sum: " << ft::par::reduce(v.begin(), v.end(), 0L)
+        << ", expected: " << (long)n * (n + 1) / 2 << std::endl;
+    std::cout << "max: " << ft::par::reduce(v.begin(), v.end(), 0,
+        par_test_max()) << ", empty: " << ft::par::reduce(v.begin(),
+        v.begin(), 42) << std::endl;
+
+    std::cout << "### FT::PAR: sort" << std::endl;
+    srand(42);
+    ft::vector<int> s;
+    for (int i = 0; i < 300000; i++)
+        s.push_back(rand() % 100000 - 50000);
+    std::vector<int> ref(s.begin(), s.end());
+    std::sort(ref.begin(), ref.end());
+    ft::par::sort(s.begin(), s.end());
+    std::cout << "matches std::sort: " << std::equal(ref.begin(), ref.end(),
+        s.begin()) << std::endl;
+    ft::vector<ft::pair<int, int> > keyed;
+    for (int i = 0; i < 200000; i++)
+        keyed.push_back(ft::make_pair(rand() % 100, i));
+    ft::par::stable_sort(keyed.begin(), keyed.end(), par_test_by_key());
+    ok = true;
+    for (size_t i = 1; i < keyed.size(); i++)
+        ok = ok && (keyed[i - 1].first < keyed[i].first
+            || (keyed[i - 1].first == keyed[i].first
+                && keyed[i - 1].second < keyed[i].second));
+    std::cout << "stable on equal keys: " << ok << std::endl;
+    std::string small = "parallel";
+    ft::par::sort(small.begin(), small.end());
+    std::cout << "small range: " << small << std::endl;
+    ft::par::set_thread_count(1);
+    int one[] = {5, 3, 9, 1, 7, 3};
+    ft::par::sort(one, one + 6);
+    std::cout << "one thread, raw array:";
+    for (int i = 0; i < 6; i++)
+        std::cout << " " << one[i];
+    std::cout << std::endl;
+    std::cout << std::endl;
+}
@@ -0,0 +1,65 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <cstdlib>
+#include <queue>
+#include <priority_queue.hpp>
+
+//Fills a queue of size elements, then pops and pushes ops times at that
+//size (the steady state of a scheduler), then drains it.
+template<typename Queue>
+void    priority_queue_bench_run(const std::string &name, const int *vals,
+    size_t size, size_t ops)
+{
+    Queue   q;
+    size_t  sum = 0;
+    double  start;
+
+    start = bench_now();
+    for (size_t i = 0; i < size; i++)
+        q.push(vals[i]);
+    bench_report(name + " push", size, bench_now() - start, 0);
+    start = bench_now();
+    for (size_t i = 0; i < ops; i++)
+    {
+        sum += q.top();
+        q.pop();
+        q.push(vals[size + i]);
+    }
+    bench_report(name + " pop + push", ops, bench_now() - start, 0);
+    start = bench_now();
+    for (; !q.empty(); q.pop())
+        sum += q.top();
+    bench_report(name + " pop", size, bench_now() - start, 0);
+    bench_keep(sum);
+}
+
+void    priority_queue_bench(void)
+{
+    const size_t    size = 1 << 20;
+    const size_t    ops = 1 << 22;
+    ft::vector<int> vals(size + ops);
+
+    srand(42);
+    for (size_t i = 0; i < vals.size(); i++)
+        vals[i] = rand();
+    std::cout << "### priority queue of " << size << " ints, " << ops
+        << " pop + push" << std::endl;
+    priority_queue_bench_run<std::priority_queue<int> >("std::priority_queue",
+        &vals[0], size, ops);
+    priority_queue_bench_run<ft::priority_queue<int, ft::vector<int>,
+        std::less<int>, 2> >("ft::priority_queue<2>", &vals[0], size, ops);
+    priority_queue_bench_run<ft::priority_queue<int, ft::vector<int>,
+        std::less<int>, 4> >("ft::priority_queue<4>", &vals[0], size, ops);
+    priority_queue_bench_run<ft::priority_queue<int, ft::vector<int>,
+        std::less<int>, 8> >("ft::priority_queue<8>", &vals[0], size, ops);
+    {
+        ft::priority_queue<int> q;
+        double start = bench_now();
+        q.push_range(vals.begin(), vals.begin() + size);
+        bench_report("ft::priority_queue<4> push_range", size,
+            bench_now() - start, 0);
+        bench_keep(q.top());
+    }
+}
@@ -0,0 +1,148 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <algorithm>
+#include <vector>
+
+#include <priority_queue.hpp>
+
+//Pops everything and compares with std::priority_queue fed the same way.
+template<size_t Arity>
+static bool priority_queue_test_arity(void)
+{
+    ft::priority_queue<int, ft::vector<int>, std::less<int>, Arity> q;
+    std::priority_queue<int> ref;
+    bool ok = true;
+
+    for (int round = 0; round < 2000; round++)
+    {
+        int val = rand() % 1000;
+        q.push(val);
+        ref.push(val);
+        if (round % 3 == 0)
+        {
+            ok = ok && q.top() == ref.top();
+            q.pop();
+            ref.pop();
+        }
+    }
+    std::vector<int> batch;
+    for (int i = 0; i < 5000; i++)
+        batch.push_back(rand() % 1000);
+    q.push_range(batch.begin(), batch.begin() + 100);
+    q.push_range(batch.begin() + 100, batch.end());
+    for (size_t i = 0; i < batch.size(); i++)
+        ref.push(batch[i]);
+    ok = ok && q.size() == ref.size();
+    for (; !ref.empty(); ref.pop(), q.pop())
+        ok = ok && q.top() == ref.top();
+    return ok && q.empty();
+}
+
+void    priority_queue_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::PRIORITY_QUEUE: push / pop / top" << std::endl;
+    ft::priority_queue<std::string> words;
+    words.push("pear");
+    words.push("apple");
+    words.push("quince");
+    words.push("fig");
+    std::cout << "size: " << words.size() << ", order:";
+    for (; !words.empty(); words.pop())
+        std::cout << " " << words.top();
+    std::cout << std::endl;
+    int raw[] = {5, 1, 9, 3, 7};
+    ft::priority_queue<int, ft::vector<int>, std::greater<int>, 2> mins(raw,
+        raw + 5);
+    std::cout << "min-queue from a range, top: " << mins.top() << std::endl;
+    ft::priority_queue<int, ft::vector<int>, std::greater<int>, 2> other;
+    ft::swap(mins, other);
+    std::cout << "after swap: " << mins.empty() << " " << other.size()
+        << std::endl;
+    srand(44);
+    std::cout << "arity 2 matches std: " << priority_queue_test_arity<2>()
+        << std::endl;
+    std::cout << "arity 4 matches std: " << priority_queue_test_arity<4>()
+        << std::endl;
+    std::cout << "arity 8 matches std: " << priority_queue_test_arity<8>()
+        << std::endl;
+
+    std::cout << "### FT::MAKE_HEAP / PUSH_HEAP / POP_HEAP" << std::endl;
+    ft::vector<int> h;
+    for (int i = 0; i < 10; i++)
+        h.push_back((i * 7) % 10);
+    ft::make_heap(h.begin(), h.end());
+    h.push_back(42);
+    ft::push_heap(h.begin(), h.end());
+    std::cout << "top after push_heap: " << h.front() << std::endl;
+    ft::pop_heap(h.begin(), h.end());
+    std::cout << "pop_heap moved " << h.back() << " to the back, new top: "
+        << h.front() << std::endl;
+    h.pop_back();
+    ft::sort_heap(h.begin(), h.end());
+    for (size_t i = 0; i < h.size(); i++)
+        std::cout << h[i] << " ";
+    std::cout << std::endl;
+
+    std::cout << "### FT::HANDLE_PRIORITY_QUEUE: decrease_key / update / erase"
+        << std::endl;
+    ft::handle_priority_queue<int, std::greater<int> > dist;
+    ft::handle_priority_queue<int, std::greater<int> >::handle_type a, b, c;
+    a = dist.push(50);
+    b = dist.push(30);
+    c = dist.push(40);
+    std::cout << "top: " << dist.top() << std::endl;
+    dist.decrease_key(a, 10);
+    std::cout << "decrease_key(a, 10), top: " << dist.top() << ", is a: "
+        << (dist.top_handle() == a) << std::endl;
+    dist.update(a, 60);
+    std::cout << "update(a, 60), top: " << dist.top() << ", value(a): "
+        << dist.value(a) << std::endl;
+    dist.erase(b);
+    std::cout << "erase(b), top: " << dist.top() << ", contains(b): "
+        << dist.contains(b) << ", value(c): " << dist.value(c) << ", size: "
+        << dist.size() << std::endl;
+    ft::handle_priority_queue<int, std::greater<int> >::handle_type d
+        = dist.push(5);
+    std::cout << "reused handle: " << (d == b) << ", top: " << dist.top()
+        << std::endl;
+    try
+    {
+        dist.pop();
+        dist.value(d);
+    }
+    catch (std::out_of_range &e)
+    {
+        std::cout << "stale handle: " << e.what() << std::endl;
+    }
+    bool ok = true;
+    ft::handle_priority_queue<int, std::less<int>, 8> big;
+    ft::vector<ft::handle_priority_queue<int, std::less<int>, 8>::handle_type>
+        handles;
+    std::vector<int> vals;
+    for (int i = 0; i < 3000; i++)
+    {
+        vals.push_back(rand() % 10000);
+        handles.push_back(big.push(vals.back()));
+    }
+    for (int i = 0; i < 3000; i += 3)
+    {
+        vals[i] = rand() % 10000;
+        big.update(handles[i], vals[i]);
+    }
+    std::sort(vals.begin(), vals.end());
+    for (; !big.empty(); big.pop())
+    {
+        ok = ok && big.top() == vals.back();
+        vals.pop_back();
+    }
+    std::cout << "3000 updates then pops in order: " << ok << std::endl;
+    std::cout << std::endl;
+}
@@ -176,12 +176,12 @@ void    rbtree_test(void)
     //ite = rbtree.end();
     while (ite != it)
     {
+        --ite;
+        --mite;
         std::cout << "mite->first: " << mite->first
         << " mite->second: " << mite->second << "\t"
         << "ite->first: " << ite->first
         << " ite->second: " << ite->second << std::endl;
-        --ite;
-        --mite;
     }
 
     ft::RBTree<ft::pair<const int, std::string> >::reverse_iterator rit = rbtree.rbegin();
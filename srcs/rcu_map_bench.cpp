@@ -0,0 +1,163 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <sstream>
+#include <pthread.h>
+#include <unistd.h>
+#include <rcu_map.hpp>
+
+//Baselines: ft::map behind a mutex or a reader-writer lock.
+struct rcu_map_bench_mutex {
+    pthread_mutex_t     lock;
+    ft::map<int, int>   map;
+
+    rcu_map_bench_mutex(void) { pthread_mutex_init(&lock, NULL); }
+    ~rcu_map_bench_mutex(void) { pthread_mutex_destroy(&lock); }
+
+    bool find(int key, int &out)
+    {
+        pthread_mutex_lock(&lock);
+        ft::map<int, int>::iterator it = map.find(key);
+        bool found = it != map.end();
+        if (found)
+            out = it->second;
+        pthread_mutex_unlock(&lock);
+        return found;
+    }
+
+    void insert_or_assign(const ft::pair<int, int> &val)
+    {
+        pthread_mutex_lock(&lock);
+        map[val.first] = val.second;
+        pthread_mutex_unlock(&lock);
+    }
+
+    void store(const ft::map<int, int> &next)
+    {
+        pthread_mutex_lock(&lock);
+        map = next;
+        pthread_mutex_unlock(&lock);
+    }
+};
+
+struct rcu_map_bench_rwlock {
+    pthread_rwlock_t    lock;
+    ft::map<int, int>   map;
+
+    rcu_map_bench_rwlock(void) { pthread_rwlock_init(&lock, NULL); }
+    ~rcu_map_bench_rwlock(void) { pthread_rwlock_destroy(&lock); }
+
+    bool find(int key, int &out)
+    {
+        pthread_rwlock_rdlock(&lock);
+        ft::map<int, int>::iterator it = map.find(key);
+        bool found = it != map.end();
+        if (found)
+            out = it->second;
+        pthread_rwlock_unlock(&lock);
+        return found;
+    }
+
+    void insert_or_assign(const ft::pair<int, int> &val)
+    {
+        pthread_rwlock_wrlock(&lock);
+        map[val.first] = val.second;
+        pthread_rwlock_unlock(&lock);
+    }
+
+    void store(const ft::map<int, int> &next)
+    {
+        pthread_rwlock_wrlock(&lock);
+        map = next;
+        pthread_rwlock_unlock(&lock);
+    }
+};
+
+//Readers look up ops random keys. The writer makes one update every
+//millisecond until the last reader is done.
+template<typename Map>
+struct rcu_map_bench_job {
+    Map     *map;
+    bool    writer;
+    int     keys;
+    size_t  ops;
+    size_t  sum;
+    int     *readers_left;
+    size_t  updates;
+
+    void run(void)
+    {
+        int val;
+
+        if (writer)
+        {
+            while (__atomic_load_n(readers_left, __ATOMIC_ACQUIRE))
+            {
+                map->insert_or_assign(ft::make_pair(
+                    static_cast<int>(ft::thread_random() % keys),
+                    static_cast<int>(updates)));
+                updates++;
+                usleep(1000);
+            }
+            return;
+        }
+        for (size_t i = 0; i < ops; i++)
+            if (map->find(static_cast<int>(ft::thread_random() % keys), val))
+                sum += val;
+        __atomic_sub_fetch(readers_left, 1, __ATOMIC_RELEASE);
+    }
+};
+
+template<typename Map>
+static void rcu_map_bench_run(const std::string &name, size_t readers,
+    int keys, size_t ops)
+{
+    Map                                 map;
+    ft::vector<rcu_map_bench_job<Map> > jobs(readers + 1);
+    int                                 readers_left = readers;
+    size_t                              sum = 0;
+    std::ostringstream                  tag;
+    double                              sec;
+    ft::map<int, int>                   init;
+
+    for (int k = 0; k < keys; k++)
+        init.insert(ft::make_pair(k, k));
+    map.store(init);
+    for (size_t t = 0; t <= readers; t++)
+    {
+        jobs[t].map = &map;
+        jobs[t].writer = t == readers;
+        jobs[t].keys = keys;
+        jobs[t].ops = ops / readers;
+        jobs[t].sum = 0;
+        jobs[t].readers_left = &readers_left;
+        jobs[t].updates = 0;
+    }
+    sec = bench_threads(jobs);
+    for (size_t t = 0; t <= readers; t++)
+        sum += jobs[t].sum;
+    tag << name << bench_thread_tag(readers, "reader") << ", "
+        << jobs[readers].updates << " updates";
+    bench_report(tag.str(), ops, sec, 0);
+    bench_keep(sum);
+}
+
+void    rcu_map_bench(void)
+{
+    const int       keys = 10000;
+    const size_t    ops = 1 << 22;
+    long            cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    std::cout << "### read-mostly map, " << keys << " keys, " << ops
+        << " lookups by the readers, one writer, " << cpus << " online CPUs"
+        << std::endl;
+    for (size_t t = 1; t <= 4; t *= 2)
+    {
+        rcu_map_bench_run<rcu_map_bench_mutex>("mutex + ft::map", t, keys,
+            ops);
+        rcu_map_bench_run<rcu_map_bench_rwlock>("rwlock + ft::map", t, keys,
+            ops);
+        rcu_map_bench_run<ft::rcu_map<int, int> >("ft::rcu_map", t, keys, ops);
+    }
+}
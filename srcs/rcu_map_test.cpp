@@ -0,0 +1,114 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <pthread.h>
+
+#include <rcu_map.hpp>
+
+typedef ft::rcu_map<int, int> rcu_map_test_t;
+
+//Gives every key the same new value in one update.
+struct rcu_map_test_set_all {
+    int val;
+
+    explicit rcu_map_test_set_all(int _val): val(_val) {}
+
+    void operator()(rcu_map_test_t::map_type &m) const
+    {
+        for (rcu_map_test_t::map_type::iterator it = m.begin(); it != m.end();
+            ++it)
+            it->second = val;
+    }
+};
+
+struct rcu_map_test_job {
+    rcu_map_test_t  *map;
+    int             done;
+    bool            consistent;
+};
+
+//A reader must never see a half done update: all values of a snapshot
+//are equal.
+static void *rcu_map_test_reader(void *arg)
+{
+    rcu_map_test_job *job = static_cast<rcu_map_test_job *>(arg);
+
+    job->consistent = true;
+    while (!__atomic_load_n(&job->done, __ATOMIC_ACQUIRE))
+    {
+        rcu_map_test_t::snapshot s = job->map->read();
+        int first = s->begin()->second;
+        for (rcu_map_test_t::map_type::const_iterator it = s->begin();
+            it != s->end(); ++it)
+            job->consistent = job->consistent && it->second == first;
+    }
+    return NULL;
+}
+
+static bool rcu_map_test_threads(void)
+{
+    const int           readers = 3;
+    rcu_map_test_t      map;
+    rcu_map_test_job    jobs[readers];
+    pthread_t           ids[readers];
+    bool                ok = true;
+    int                 val = 0;
+
+    for (int k = 0; k < 200; k++)
+        map.insert(ft::make_pair(k, 0));
+    for (int t = 0; t < readers; t++)
+    {
+        jobs[t].map = &map;
+        jobs[t].done = 0;
+        pthread_create(&ids[t], NULL, rcu_map_test_reader, &jobs[t]);
+    }
+    for (int v = 1; v <= 300; v++)
+        map.update(rcu_map_test_set_all(v));
+    for (int t = 0; t < readers; t++)
+    {
+        __atomic_store_n(&jobs[t].done, 1, __ATOMIC_RELEASE);
+        pthread_join(ids[t], NULL);
+        ok = ok && jobs[t].consistent;
+    }
+    return ok && map.find(199, val) && val == 300;
+}
+
+void    rcu_map_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::RCU_MAP: insert / erase / find / snapshot"
+        << std::endl;
+    ft::rcu_map<std::string, int> routes;
+    std::cout << "empty: " << routes.empty() << std::endl;
+    std::cout << "insert: " << routes.insert(ft::make_pair(std::string("a"), 1))
+        << " " << routes.insert(ft::make_pair(std::string("b"), 2))
+        << ", again: " << routes.insert(ft::make_pair(std::string("a"), 9))
+        << ", size: " << routes.size() << std::endl;
+    ft::rcu_map<std::string, int>::snapshot before = routes.read();
+    routes.insert_or_assign(ft::make_pair(std::string("a"), 10));
+    routes.insert_or_assign(ft::make_pair(std::string("c"), 3));
+    std::cout << "erase(b): " << routes.erase("b") << ", again: "
+        << routes.erase("b") << std::endl;
+    int val = 0;
+    std::cout << "find(a): " << routes.find("a", val) << " " << val
+        << ", count(b): " << routes.count("b") << ", size: " << routes.size()
+        << std::endl;
+    std::cout << "snapshot taken before:";
+    for (ft::map<std::string, int>::const_iterator it = before->begin();
+        it != before->end(); ++it)
+        std::cout << " " << it->first << "=" << it->second;
+    std::cout << std::endl;
+    ft::map<std::string, int> table;
+    table["x"] = 24;
+    routes.store(table);
+    std::cout << "after store: " << routes.size() << " " << routes.count("x")
+        << std::endl;
+
+    std::cout << "### FT::RCU_MAP: 3 readers, 300 updates" << std::endl;
+    std::cout << "readers never see half an update: " << rcu_map_test_threads()
+        << std::endl;
+    std::cout << std::endl;
+}
@@ -0,0 +1,128 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <pthread.h>
+#include <unistd.h>
+#include <sharded_map.hpp>
+
+//The baseline: ft::map behind one global mutex.
+struct sharded_map_bench_locked {
+    pthread_mutex_t     lock;
+    ft::map<int, int>   map;
+
+    sharded_map_bench_locked(void) { pthread_mutex_init(&lock, NULL); }
+    ~sharded_map_bench_locked(void) { pthread_mutex_destroy(&lock); }
+
+    bool insert(const ft::pair<int, int> &val)
+    {
+        pthread_mutex_lock(&lock);
+        bool inserted = map.insert(val).second;
+        pthread_mutex_unlock(&lock);
+        return inserted;
+    }
+
+    size_t erase(int key)
+    {
+        pthread_mutex_lock(&lock);
+        size_t n = map.erase(key);
+        pthread_mutex_unlock(&lock);
+        return n;
+    }
+
+    bool find(int key, int &out)
+    {
+        pthread_mutex_lock(&lock);
+        ft::map<int, int>::iterator it = map.find(key);
+        bool found = it != map.end();
+        if (found)
+            out = it->second;
+        pthread_mutex_unlock(&lock);
+        return found;
+    }
+};
+
+//Insert heavy: every thread inserts its own range of new keys.
+//Mixed: 50% find, 25% insert, 25% erase on random keys.
+template<typename Map>
+struct sharded_map_bench_job {
+    Map     *map;
+    int     first;
+    size_t  ops;
+    bool    mixed;
+    size_t  hits;
+
+    void run(void)
+    {
+        int val;
+
+        for (size_t i = 0; i < ops; i++)
+        {
+            if (!mixed)
+            {
+                hits += map->insert(ft::make_pair(
+                    first + static_cast<int>(i), 0));
+                continue;
+            }
+            unsigned int r = ft::thread_random();
+            int key = static_cast<int>((r >> 4) % (1 << 18));
+            if (r % 4 < 2)
+                hits += map->find(key, val);
+            else if (r % 4 == 2)
+                hits += map->insert(ft::make_pair(key, key));
+            else
+                hits += map->erase(key);
+        }
+    }
+};
+
+template<typename Map>
+static void sharded_map_bench_run(const std::string &name, size_t threads,
+    bool mixed, size_t ops)
+{
+    Map                                     map;
+    ft::vector<sharded_map_bench_job<Map> > jobs(threads);
+    size_t                                  hits = 0;
+    double                                  sec;
+
+    for (size_t t = 0; t < threads; t++)
+    {
+        jobs[t].map = &map;
+        jobs[t].first = static_cast<int>(t * (ops / threads));
+        jobs[t].ops = ops / threads;
+        jobs[t].mixed = mixed;
+        jobs[t].hits = 0;
+    }
+    sec = bench_threads(jobs);
+    for (size_t t = 0; t < threads; t++)
+        hits += jobs[t].hits;
+    bench_report(name, ops, sec, 0);
+    bench_keep(hits);
+}
+
+void    sharded_map_bench(void)
+{
+    const size_t    ops = 1 << 19;
+    long            cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t          max_threads = cpus > 8 ? cpus : 8;
+    typedef ft::sharded_map<int, int>   mutex_shards;
+    typedef ft::sharded_map<int, int, std::less<int>, ft::shard_hash<int>,
+        ft::shard_rwlock>               rwlock_shards;
+
+    std::cout << "### sharded map, " << ops << " ops, 64 shards, " << cpus
+        << " online CPUs" << std::endl;
+    for (int mixed = 0; mixed < 2; mixed++)
+    {
+        for (size_t t = 1; t <= max_threads; t *= 2)
+        {
+            std::string tag = (mixed ? " mixed" : " insert")
+                + bench_thread_tag(t);
+            sharded_map_bench_run<sharded_map_bench_locked>(
+                "mutex + ft::map" + tag, t, mixed, ops);
+            sharded_map_bench_run<mutex_shards>("ft::sharded_map" + tag, t,
+                mixed, ops);
+            sharded_map_bench_run<rwlock_shards>("ft::sharded_map rwlock"
+                + tag, t, mixed, ops);
+        }
+    }
+}
@@ -0,0 +1,135 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+#include <sharded_map.hpp>
+
+//Collects what for_each_ordered() visits.
+struct sharded_map_test_collect {
+    std::vector<int> keys;
+
+    void operator()(const ft::pair<const int, int> &val)
+    {
+        keys.push_back(val.first);
+    }
+};
+
+struct sharded_map_test_print {
+    void operator()(const ft::pair<const std::string, int> &val) const
+    {
+        std::cout << " " << val.first << "=" << val.second;
+    }
+};
+
+//Doubles every value of a shard.
+struct sharded_map_test_double {
+    void operator()(ft::map<int, int> &m) const
+    {
+        for (ft::map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+            it->second *= 2;
+    }
+};
+
+typedef ft::sharded_map<int, int, std::less<int>, ft::shard_hash<int>,
+    ft::shard_rwlock> sharded_map_test_t;
+
+struct sharded_map_test_job {
+    sharded_map_test_t  *map;
+    int                 id;
+};
+
+//Thread id inserts the keys k with k % 4 == id and erases the odd ones.
+static void *sharded_map_test_worker(void *arg)
+{
+    sharded_map_test_job *job = static_cast<sharded_map_test_job *>(arg);
+    int val;
+
+    for (int k = job->id; k < 20000; k += 4)
+        job->map->insert(ft::make_pair(k, k));
+    for (int k = job->id; k < 20000; k += 4)
+        if (k % 2)
+            job->map->erase(k);
+        else
+            job->map->find(k, val);
+    return NULL;
+}
+
+static bool sharded_map_test_threads(void)
+{
+    const int               threads = 4;
+    sharded_map_test_t      map(8);
+    sharded_map_test_job    jobs[threads];
+    pthread_t               ids[threads];
+    sharded_map_test_collect seen;
+    bool                    ok = true;
+
+    for (int t = 0; t < threads; t++)
+    {
+        jobs[t].map = &map;
+        jobs[t].id = t;
+        pthread_create(&ids[t], NULL, sharded_map_test_worker, &jobs[t]);
+    }
+    for (int t = 0; t < threads; t++)
+        pthread_join(ids[t], NULL);
+    seen = map.for_each_ordered(seen);
+    for (size_t i = 0; i < seen.keys.size(); i++)
+        ok = ok && seen.keys[i] == static_cast<int>(2 * i);
+    return ok && seen.keys.size() == 10000 && map.size() == 10000;
+}
+
+void    sharded_map_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::SHARDED_MAP: insert / find / erase" << std::endl;
+    ft::sharded_map<std::string, int> sessions(5);
+    std::cout << "shards: " << sessions.shard_count() << ", empty: "
+        << sessions.empty() << std::endl;
+    std::cout << "insert: "
+        << sessions.insert(ft::make_pair(std::string("carol"), 3)) << " "
+        << sessions.insert(ft::make_pair(std::string("alice"), 1)) << " "
+        << sessions.insert(ft::make_pair(std::string("bob"), 2))
+        << ", again: "
+        << sessions.insert(ft::make_pair(std::string("bob"), 7)) << std::endl;
+    sessions.insert_or_assign(ft::make_pair(std::string("bob"), 20));
+    int val = 0;
+    std::cout << "find(bob): " << sessions.find("bob", val) << " " << val
+        << ", count(dave): " << sessions.count("dave") << ", erase(carol): "
+        << sessions.erase("carol") << ", size: " << sessions.size()
+        << std::endl;
+    std::cout << "ordered:";
+    sessions.for_each_ordered(sharded_map_test_print());
+    std::cout << std::endl;
+    sessions.clear();
+    std::cout << "after clear: " << sessions.empty() << std::endl;
+
+    std::cout << "### FT::SHARDED_MAP: bulk insert / with_shard / ordered merge"
+        << std::endl;
+    ft::sharded_map<int, int> ints(16);
+    ft::map<int, int> batch;
+    for (int i = 0; i < 1000; i++)
+        batch.insert(ft::make_pair((i * 7919) % 1000, i));
+    std::cout << "bulk insert of 1000: " << ints.insert(batch.begin(),
+        batch.end()) << ", again: " << ints.insert(batch.begin(), batch.end())
+        << std::endl;
+    size_t shard = ints.shard_of(500);
+    ints.with_shard(shard, sharded_map_test_double());
+    ints.find(500, val);
+    std::cout << "with_shard doubled key 500: " << (val == 2 * batch[500])
+        << std::endl;
+    sharded_map_test_collect all = ints.for_each_ordered(
+        sharded_map_test_collect());
+    bool ok = all.keys.size() == 1000;
+    for (size_t i = 0; ok && i < all.keys.size(); i++)
+        ok = all.keys[i] == static_cast<int>(i);
+    std::cout << "16 shards merged in key order: " << ok << std::endl;
+
+    std::cout << "### FT::SHARDED_MAP: 4 threads, rwlock shards" << std::endl;
+    std::cout << "right keys in order at the end: " << sharded_map_test_threads()
+        << std::endl;
+    std::cout << std::endl;
+}
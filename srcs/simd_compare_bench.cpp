@@ -0,0 +1,86 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <functional>
+#include <string>
+#include <vector.hpp>
+
+//Element by element, through the generic ft::equal(..., comp) loop.
+template<typename T>
+struct simd_compare_differs {
+    bool operator()(const T &a, const T &b) const { return a != b; }
+};
+
+//Two equal 1 MB vectors, so every comparison reads both buffers to the end.
+template<typename T>
+void    simd_compare_bench_type(const std::string &name)
+{
+    const size_t    bytes = 1 << 20;
+    const size_t    rounds = 2000;
+    ft::vector<T>   a;
+    ft::vector<T>   b;
+    size_t          hits;
+    double          start;
+    double          sec;
+
+    for (size_t i = 0; i < bytes / sizeof(T); i++)
+        a.push_back(static_cast<T>(i * 2654435761u));
+    b = a;
+    {
+        hits = 0;
+        start = bench_now();
+        for (size_t r = 0; r < rounds; r++)
+            hits += ft::equal(a.begin(), a.end(), b.begin(), b.end(),
+                simd_compare_differs<T>());
+        sec = bench_now() - start;
+        bench_report("ft::vector<" + name + "> == 1MB, generic", rounds, sec, 0);
+        std::cout << std::setw(48) << "" << bytes * rounds / sec / 1e9
+            << " GB/s" << std::endl;
+        bench_keep(hits);
+    }
+    {
+        hits = 0;
+        start = bench_now();
+        for (size_t r = 0; r < rounds; r++)
+            hits += a == b;
+        sec = bench_now() - start;
+        bench_report("ft::vector<" + name + "> == 1MB", rounds, sec, 0);
+        std::cout << std::setw(48) << "" << bytes * rounds / sec / 1e9
+            << " GB/s" << std::endl;
+        bench_keep(hits);
+    }
+    {
+        hits = 0;
+        start = bench_now();
+        for (size_t r = 0; r < rounds; r++)
+            hits += ft::lexicographical_compare(a.begin(), a.end(), b.begin(),
+                b.end(), std::less<T>());
+        sec = bench_now() - start;
+        bench_report("ft::vector<" + name + "> < 1MB, generic", rounds, sec, 0);
+        std::cout << std::setw(48) << "" << bytes * rounds / sec / 1e9
+            << " GB/s" << std::endl;
+        bench_keep(hits);
+    }
+    {
+        hits = 0;
+        start = bench_now();
+        for (size_t r = 0; r < rounds; r++)
+            hits += a < b;
+        sec = bench_now() - start;
+        bench_report("ft::vector<" + name + "> < 1MB", rounds, sec, 0);
+        std::cout << std::setw(48) << "" << bytes * rounds / sec / 1e9
+            << " GB/s" << std::endl;
+        bench_keep(hits);
+    }
+}
+
+void    simd_compare_bench(void)
+{
+    std::cout << "### equality and ordering of two equal 1MB vectors"
+        << std::endl;
+    simd_compare_bench_type<unsigned char>("unsigned char");
+    simd_compare_bench_type<signed char>("signed char");
+    simd_compare_bench_type<int>("int");
+    simd_compare_bench_type<double>("double");
+}
@@ -0,0 +1,97 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include <list>
+#include <limits>
+
+#include <vector.hpp>
+#include <devector.hpp>
+
+//Changes element i of b around every size and checks ==, < and > against
+//the element by element std algorithms.
+template<typename T>
+bool    simd_compare_check(T bump)
+{
+    bool ok = true;
+
+    for (size_t n = 0; n < 300; n += (n < 70 ? 1 : 23))
+    {
+        ft::vector<T> a;
+        for (size_t i = 0; i < n; i++)
+            a.push_back(static_cast<T>(rand() % 100 - 50));
+        for (size_t i = 0; i <= n; i++)
+        {
+            ft::vector<T> b(a);
+            if (i < n)
+                b[i] = static_cast<T>(b[i] + bump);
+            else
+                b.push_back(bump);
+            ok = ok && (a == b) == (a.size() == b.size()
+                && std::equal(a.begin(), a.end(), b.begin()));
+            ok = ok && (a < b) == std::lexicographical_compare(a.begin(),
+                a.end(), b.begin(), b.end());
+            ok = ok && (b < a) == std::lexicographical_compare(b.begin(),
+                b.end(), a.begin(), a.end());
+            ok = ok && a == a && !(a < a);
+        }
+    }
+    return ok;
+}
+
+void    simd_compare_test(void)
+{
+    std::cout << std::boolalpha;
+    std::cout << "### FT::EQUAL / LEXICOGRAPHICAL_COMPARE: contiguous ranges"
+        << std::endl;
+    srand(41);
+    std::cout << "char: " << simd_compare_check<char>(-100) << std::endl;
+    std::cout << "signed char: " << simd_compare_check<signed char>(-100)
+        << std::endl;
+    std::cout << "unsigned char: " << simd_compare_check<unsigned char>(200)
+        << std::endl;
+    std::cout << "short: " << simd_compare_check<short>(-1000) << std::endl;
+    std::cout << "int: " << simd_compare_check<int>(-256) << std::endl;
+    std::cout << "unsigned int: " << simd_compare_check<unsigned int>(256)
+        << std::endl;
+    std::cout << "long: " << simd_compare_check<long>(1L << 40) << std::endl;
+    std::cout << "float: " << simd_compare_check<float>(0.5f) << std::endl;
+    std::cout << "double: " << simd_compare_check<double>(-0.25) << std::endl;
+
+    std::cout << "### FT::EQUAL / LEXICOGRAPHICAL_COMPARE: NaN and -0.0"
+        << std::endl;
+    ft::vector<double> x(100, 1.0);
+    ft::vector<double> y(x);
+    x[70] = 0.0;
+    y[70] = -0.0;
+    std::cout << "0.0 vs -0.0, equal: " << (x == y) << ", less: " << (x < y)
+        << ", greater: " << (y < x) << std::endl;
+    x[80] = y[80] = std::numeric_limits<double>::quiet_NaN();
+    std::cout << "NaN on both sides, equal: " << (x == y) << std::endl;
+    x[90] = 2.0;
+    std::cout << "NaN skipped by <: " << (y < x) << ", " << (x < y)
+        << std::endl;
+
+    std::cout << "### FT::EQUAL / LEXICOGRAPHICAL_COMPARE: mixed ranges"
+        << std::endl;
+    std::string s = "contiguous";
+    ft::devector<char> d(s.begin(), s.end());
+    const ft::vector<char> v(s.begin(), s.end());
+    std::list<char> l(s.begin(), s.end());
+    std::cout << "devector == const vector: "
+        << ft::equal(d.begin(), d.end(), v.begin(), v.end()) << std::endl;
+    std::cout << "pointers == vector: "
+        << ft::equal(s.data(), s.data() + s.size(), v.begin(), v.end())
+        << std::endl;
+    std::cout << "list < vector (generic path): "
+        << ft::lexicographical_compare(l.begin(), l.end(), v.begin(),
+            v.end() - 1) << std::endl;
+    std::cout << "empty == empty: " << (ft::vector<int>() == ft::vector<int>())
+        << ", empty < {0}: " << (ft::vector<int>() < ft::vector<int>(1, 0))
+        << std::endl;
+    std::cout << std::endl;
+}
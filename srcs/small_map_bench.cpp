@@ -0,0 +1,45 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <sstream>
+
+#include <map.hpp>
+#include <small_map.hpp>
+
+//One "request": build a map of n entries, look every key up, drop the map.
+template<typename Map>
+void    small_map_bench_run(const std::string &name, int n, int requests)
+{
+    size_t  allocs = bench_allocs();
+    double  start = bench_now();
+
+    for (int r = 0; r < requests; r++)
+    {
+        Map m;
+        for (int i = 0; i < n; i++)
+            m.insert(ft::make_pair((i * 7 + r) % (n * 2 + 1), i));
+        for (int i = 0; i < n; i++)
+            bench_keep(m.count(i));
+    }
+    std::ostringstream label;
+    label << name << " n=" << n;
+    bench_report(label.str(), requests, bench_now() - start,
+        bench_allocs() - allocs);
+}
+
+void    small_map_bench(void)
+{
+    const int   requests = 1000000;
+    const int   sizes[] = {1, 4, 8, 16};
+
+    std::cout << "### small_map vs map (per request)" << std::endl;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); i++)
+    {
+        small_map_bench_run<ft::map<int, int> >(
+            "ft::map<int, int>", sizes[i], requests);
+        small_map_bench_run<ft::small_map<int, int, 8> >(
+            "ft::small_map<int, int, 8>", sizes[i], requests);
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,72 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <small_map.hpp>
+
+template<typename T>
+void    printSmallMap(T &m, std::string name)
+{
+    std::cout << name << " (inline: " << std::boolalpha << m.is_inline()
+        << ", size: " << m.size() << "):\t";
+    for (typename T::iterator it = m.begin(); it != m.end(); ++it)
+        std::cout << "[" << it->first << "]: " << it->second << ",   ";
+    std::cout << std::endl;
+}
+
+void    small_map_test(void)
+{
+    ft::small_map<int, std::string, 4> m;
+
+    std::cout << "### FT::SMALL_MAP: insert up to N = "
+        << m.inline_capacity() << std::endl;
+    m[30] = "thirty";
+    m[10] = "ten";
+    m.insert(ft::make_pair(20, std::string("twenty")));
+    m.insert(ft::make_pair(20, std::string("again")));
+    m[40] = "forty";
+    printSmallMap(m, "m");
+
+    std::cout << "m.find(20): " << m.find(20)->second << std::endl;
+    std::cout << "m.count(25): " << m.count(25) << std::endl;
+    std::cout << "m.lower_bound(25): " << m.lower_bound(25)->first << std::endl;
+    std::cout << "m.upper_bound(30): " << m.upper_bound(30)->first << std::endl;
+
+    std::cout << "reverse:\t";
+    for (ft::small_map<int, std::string, 4>::reverse_iterator rit = m.rbegin();
+        rit != m.rend(); ++rit)
+        std::cout << rit->first << ", ";
+    std::cout << std::endl << std::endl;
+
+    std::cout << "### FT::SMALL_MAP: copy and spill into the tree" << std::endl;
+    ft::small_map<int, std::string, 4> m2(m);
+    m[50] = "fifty";
+    m[5] = "five";
+    printSmallMap(m, "m");
+    printSmallMap(m2, "m2");
+    std::cout << "m.find(50): " << m.find(50)->second << std::endl;
+    std::cout << "m.lower_bound(25): " << m.lower_bound(25)->first << std::endl;
+    std::cout << "m == m2: " << std::boolalpha << (m == m2) << std::endl;
+    std::cout << "m2 < m: " << std::boolalpha << (m2 < m) << std::endl;
+
+    std::cout << "m.swap(m2)" << std::endl;
+    m.swap(m2);
+    printSmallMap(m, "m");
+    printSmallMap(m2, "m2");
+    std::cout << std::endl;
+
+    std::cout << "### FT::SMALL_MAP: erase" << std::endl;
+    m.erase(20);
+    m.erase(m.begin());
+    printSmallMap(m, "m");
+    m2.erase(m2.find(30), m2.end());
+    printSmallMap(m2, "m2");
+    m2.clear();
+    m2[1] = "one";
+    printSmallMap(m2, "m2 after clear");
+    std::cout << std::endl;
+}
@@ -0,0 +1,44 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <sstream>
+
+#include <vector.hpp>
+#include <small_vector.hpp>
+
+//Build a short-lived vector of n ints, sum it, drop it.
+template<typename Vec>
+void    small_vector_bench_run(const std::string &name, int n, int rounds)
+{
+    size_t  allocs = bench_allocs();
+    double  start = bench_now();
+
+    for (int r = 0; r < rounds; r++)
+    {
+        Vec v;
+        for (int i = 0; i < n; i++)
+            v.push_back(i + r);
+        bench_keep(v[n - 1] + v.size());
+    }
+    std::ostringstream label;
+    label << name << " n=" << n;
+    bench_report(label.str(), rounds, bench_now() - start,
+        bench_allocs() - allocs);
+}
+
+void    small_vector_bench(void)
+{
+    const int   rounds = 5000000;
+    const int   sizes[] = {1, 4, 8, 16};
+
+    std::cout << "### small_vector vs vector (per vector)" << std::endl;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); i++)
+    {
+        small_vector_bench_run<ft::vector<int> >(
+            "ft::vector<int>", sizes[i], rounds);
+        small_vector_bench_run<ft::small_vector<int, 16> >(
+            "ft::small_vector<int, 16>", sizes[i], rounds);
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,78 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <small_vector.hpp>
+
+template<typename T>
+void    printSmallVec(T &v, std::string name)
+{
+    std::cout << name << " (inline: " << std::boolalpha << v.is_inline()
+        << ", cap: " << v.capacity() << "):\t";
+    for (size_t i = 0; i < v.size(); i++)
+        std::cout << "[" << i << "]:  " << v[i] << ",   ";
+    std::cout << std::endl;
+}
+
+void    small_vector_test(void)
+{
+    std::cout << "### FT::SMALL_VECTOR: push_back up to N" << std::endl;
+    ft::small_vector<std::string, 4> v;
+    v.push_back("one");
+    v.push_back("two");
+    v.push_back("three");
+    printSmallVec(v, "v");
+
+    std::cout << "### FT::SMALL_VECTOR: spill to the allocator" << std::endl;
+    v.push_back("four");
+    v.push_back("five");
+    printSmallVec(v, "v");
+
+    std::cout << "### FT::SMALL_VECTOR: insert / erase" << std::endl;
+    v.insert(v.begin(), "zero");
+    v.insert(v.begin() + 2, 2, "x");
+    printSmallVec(v, "v");
+    v.erase(v.begin() + 2, v.begin() + 4);
+    v.erase(v.begin());
+    printSmallVec(v, "v");
+
+    std::cout << "### FT::SMALL_VECTOR: shared ft::vector iterators" << std::endl;
+    ft::vector<std::string>::iterator it = v.begin();
+    ft::vector<std::string> copy(it, v.end());
+    std::cout << "ft::vector copy from small_vector iterators: " << copy.size()
+        << " elements, back: " << copy.back() << std::endl;
+    std::cout << "reverse:\t";
+    for (ft::small_vector<std::string, 4>::reverse_iterator rit = v.rbegin();
+        rit != v.rend(); ++rit)
+        std::cout << *rit << ", ";
+    std::cout << std::endl;
+
+    std::cout << "### FT::SMALL_VECTOR: shrink back inline" << std::endl;
+    v.resize(3);
+    v.shrink_to_fit();
+    printSmallVec(v, "v");
+
+    std::cout << "### FT::SMALL_VECTOR: copy, swap, compare" << std::endl;
+    ft::small_vector<std::string, 4> v2(6, "y");
+    ft::small_vector<std::string, 4> v3(v);
+    v.swap(v2);
+    printSmallVec(v, "v");
+    printSmallVec(v2, "v2");
+    std::cout << "v2 == v3: " << std::boolalpha << (v2 == v3) << std::endl;
+    std::cout << "v < v2: " << std::boolalpha << (v < v2) << std::endl;
+    try
+    {
+        v2.at(10);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+    v.clear();
+    printSmallVec(v, "v after clear");
+    std::cout << std::endl;
+}
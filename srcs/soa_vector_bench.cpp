@@ -0,0 +1,87 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <vector.hpp>
+#include <soa_vector.hpp>
+
+struct BenchName
+{
+    char    s[36];
+};
+
+//56 bytes, of which a price scan needs 8.
+struct BenchOrder
+{
+    long        id;
+    double      price;
+    int         qty;
+    BenchName   name;
+};
+
+void    soa_vector_bench(void)
+{
+    const size_t    count = 1 << 22;
+    const int       rounds = 10;
+    BenchName       name = {{0}};
+    double          start;
+    double          sum;
+
+    ft::vector<BenchOrder> aos;
+    ft::soa_vector<long, double, int, BenchName> soa;
+    aos.reserve(count);
+    soa.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        BenchOrder o = {static_cast<long>(i), (i % 1000) * 0.25,
+            static_cast<int>(i % 100), name};
+        aos.push_back(o);
+        soa.push_back(o.id, o.price, o.qty, o.name);
+    }
+    std::cout << "### scans over " << count << " orders of "
+        << sizeof(BenchOrder) << " bytes" << std::endl;
+    {
+        sum = 0;
+        start = bench_now();
+        for (int r = 0; r < rounds; r++)
+            for (size_t i = 0; i < count; i++)
+                sum += aos[i].price;
+        bench_report("ft::vector<struct> sum(price)", count * rounds,
+            bench_now() - start, 0);
+        bench_keep(static_cast<size_t>(sum));
+    }
+    {
+        ft::span<const double> price = soa.column<1>();
+        sum = 0;
+        start = bench_now();
+        for (int r = 0; r < rounds; r++)
+            for (const double *it = price.begin(); it != price.end(); ++it)
+                sum += *it;
+        bench_report("ft::soa_vector sum(price)", count * rounds,
+            bench_now() - start, 0);
+        bench_keep(static_cast<size_t>(sum));
+    }
+    {
+        sum = 0;
+        start = bench_now();
+        for (int r = 0; r < rounds; r++)
+            for (size_t i = 0; i < count; i++)
+                sum += aos[i].qty > 50 ? aos[i].price : 0;
+        bench_report("ft::vector<struct> sum(price) where qty > 50",
+            count * rounds, bench_now() - start, 0);
+        bench_keep(static_cast<size_t>(sum));
+    }
+    {
+        ft::span<const double> price = soa.column<1>();
+        ft::span<const int> qty = soa.column<2>();
+        sum = 0;
+        start = bench_now();
+        for (int r = 0; r < rounds; r++)
+            for (size_t i = 0; i < count; i++)
+                sum += qty[i] > 50 ? price[i] : 0;
+        bench_report("ft::soa_vector sum(price) where qty > 50",
+            count * rounds, bench_now() - start, 0);
+        bench_keep(static_cast<size_t>(sum));
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,75 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <soa_vector.hpp>
+
+typedef ft::soa_vector<int, std::string, double> soa_test_t;
+
+static void print_soa_vector(const soa_test_t &v)
+{
+    for (size_t i = 0; i < v.size(); i++)
+        std::cout << "(" << v[i].get<0>() << ", " << v[i].get<1>() << ", "
+            << v[i].get<2>() << ") ";
+    std::cout << "size: " << v.size() << std::endl;
+}
+
+void    soa_vector_test(void)
+{
+    std::cout << "### FT::SOA_VECTOR: row-style push_back / operator[]"
+        << std::endl;
+    soa_test_t v;
+    v.push_back(1, "one", 1.5);
+    v.push_back(soa_test_t::value_type(2, "two", 2.5));
+    v.push_back(3, "three");
+    print_soa_vector(v);
+    v[2].get<2>() = 3.5;
+    v[0] = soa_test_t::value_type(10, "ten", 10.5);
+    v[1] = v[0];
+    soa_test_t::value_type row = v.back();
+    std::cout << "back as a row: " << row.first << " " << row.second << " "
+        << row.get<2>() << std::endl;
+    print_soa_vector(v);
+
+    std::cout << "### FT::SOA_VECTOR: columns" << std::endl;
+    ft::span<double> prices = v.column<2>();
+    double sum = 0;
+    for (ft::span<double>::iterator it = prices.begin(); it != prices.end();
+        ++it)
+        sum += *it;
+    std::cout << "sum of column 2: " << sum << ", column 1 size: "
+        << v.column<1>().size() << ", column 0 [2]: " << v.column<0>()[2]
+        << std::endl;
+
+    std::cout << "### FT::SOA_VECTOR: resize / pop_back / compare / swap"
+        << std::endl;
+    const soa_test_t c(v);
+    std::cout << "c == v: " << std::boolalpha << (c == v) << std::endl;
+    v.pop_back();
+    v.resize(4, soa_test_t::value_type(7, "seven", 7.5));
+    print_soa_vector(v);
+    std::cout << "c != v: " << (c != v) << ", c.at(1).get<1>(): "
+        << c.at(1).get<1>() << std::endl;
+    soa_test_t w(2);
+    ft::swap(v, w);
+    print_soa_vector(v);
+    try
+    {
+        w.at(4);
+    }
+    catch (std::out_of_range &e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+
+    std::cout << "### FT::SOA_VECTOR: single column" << std::endl;
+    ft::soa_vector<long> one;
+    one.push_back(5L);
+    one.push_back(6L);
+    std::cout << one[0].get<0>() + one.column<0>()[1] << std::endl;
+    std::cout << std::endl;
+}
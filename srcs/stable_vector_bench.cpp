@@ -0,0 +1,84 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <algorithm>
+#include <vector.hpp>
+#include <stable_vector.hpp>
+
+struct BenchRow
+{
+    long    id;
+    char    payload[56];
+};
+
+//Times every push_back on its own and prints the median, the 99.9th
+//percentile and the worst one: ft::vector pays for its copies there.
+template<typename Vector>
+void    stable_vector_bench_tail(const std::string &name, Vector &v,
+    size_t count)
+{
+    ft::vector<double> lat(count);
+    BenchRow row = {0, {0}};
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        t = bench_now();
+        v.push_back(row);
+        lat[i] = bench_now() - t;
+    }
+    std::sort(lat.begin(), lat.end());
+    std::cout << std::left << std::setw(48) << name << std::right
+        << std::fixed << std::setprecision(0)
+        << "p50 " << lat[count / 2] * 1e9 << " ns, p99.9 "
+        << lat[count - count / 1000] * 1e9 << " ns, max "
+        << lat[count - 1] * 1e9 << " ns" << std::endl;
+    bench_keep(v.size());
+}
+
+void    stable_vector_bench(void)
+{
+    const size_t    count = 1 << 22;
+    BenchRow        row = {0, {0}};
+    double          start;
+    size_t          allocs;
+
+    std::cout << "### push_back of " << count << " 64-byte rows" << std::endl;
+    {
+        ft::vector<BenchRow> v;
+        allocs = bench_allocs();
+        start = bench_now();
+        for (size_t i = 0; i < count; i++)
+        {
+            row.id = i;
+            v.push_back(row);
+        }
+        bench_report("ft::vector::push_back", count, bench_now() - start,
+            bench_allocs() - allocs);
+        bench_keep(v.size());
+    }
+    {
+        ft::stable_vector<BenchRow> v;
+        allocs = bench_allocs();
+        start = bench_now();
+        for (size_t i = 0; i < count; i++)
+        {
+            row.id = i;
+            v.push_back(row);
+        }
+        bench_report("ft::stable_vector::push_back", count,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(v.size());
+    }
+    {
+        ft::vector<BenchRow> v;
+        stable_vector_bench_tail("ft::vector::push_back latency", v, count);
+    }
+    {
+        ft::stable_vector<BenchRow> v;
+        stable_vector_bench_tail("ft::stable_vector::push_back latency", v,
+            count);
+    }
+    std::cout << std::endl;
+}
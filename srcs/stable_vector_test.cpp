@@ -0,0 +1,84 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <stable_vector.hpp>
+
+template<typename T>
+static void print_stable_vector(const ft::stable_vector<T> &v)
+{
+    for (typename ft::stable_vector<T>::const_iterator it = v.begin();
+        it != v.end(); ++it)
+        std::cout << *it << " ";
+    std::cout << "(size: " << v.size() << ")" << std::endl;
+}
+
+void    stable_vector_test(void)
+{
+    std::cout << "### FT::STABLE_VECTOR: addresses survive growth" << std::endl;
+    ft::stable_vector<int> v;
+    v.push_back(0);
+    int *first = &v[0];
+    ft::stable_vector<int>::iterator it = v.begin();
+    for (int i = 1; i < 1000000; i++)
+        v.push_back(i);
+    std::cout << "same address: " << std::boolalpha << (first == &v[0])
+        << ", iterator still valid: " << (it == v.begin()) << ", back: "
+        << v.back() << ", capacity >= size: " << (v.capacity() >= v.size())
+        << std::endl;
+
+    std::cout << "### FT::STABLE_VECTOR: max_capacity" << std::endl;
+    ft::stable_vector<std::string> s(ft::max_capacity(4));
+    s.push_back("a");
+    s.push_back(s[0]);
+    s.insert(s.begin(), "b");
+    s.insert(s.begin() + 1, 1, "c");
+    try
+    {
+        s.push_back("overflow");
+    }
+    catch (std::length_error &e)
+    {
+        std::cout << "length_error: " << e.what() << std::endl;
+    }
+    std::cout << "max_size: " << s.max_size() << std::endl;
+    print_stable_vector(s);
+
+    std::cout << "### FT::STABLE_VECTOR: insert / erase / resize" << std::endl;
+    ft::stable_vector<int> w(5, 7);
+    int arr[] = {1, 2, 3};
+    w.insert(w.begin() + 2, arr, arr + 3);
+    print_stable_vector(w);
+    w.erase(w.begin(), w.begin() + 2);
+    w.erase(w.end() - 1);
+    print_stable_vector(w);
+    w.resize(8, 9);
+    print_stable_vector(w);
+    w.resize(2);
+    w.shrink_to_fit();
+    w.push_back(4);
+    print_stable_vector(w);
+    try
+    {
+        w.at(10);
+    }
+    catch (std::out_of_range &e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+
+    std::cout << "### FT::STABLE_VECTOR: copy / swap / compare" << std::endl;
+    ft::stable_vector<int> c(w);
+    std::cout << "c == w: " << (c == w) << std::endl;
+    c.push_back(5);
+    std::cout << "c > w: " << (c > w) << std::endl;
+    ft::swap(c, w);
+    print_stable_vector(w);
+    w = c;
+    std::cout << "after w = c, w == c: " << (w == c) << std::endl;
+    std::cout << std::endl;
+}
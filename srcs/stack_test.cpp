@@ -53,9 +53,9 @@ void    stack_test(void)
     std::cout << "stack sint top: " << sint.top() << std::endl;
     std::cout << "stack sint_2 top: " << sint_2.top() << std::endl << std::endl;
 
-    std::cout << "stack: ft::vector<int> vint(10, 30): sint = ft::stack<int>(vint)" << std::endl;
-    ft::vector<int> vint(10, 30);
-    sint = ft::stack<int>(vint);
+    std::cout << "stack: ft::deque<int> dint(10, 30): sint = ft::stack<int>(dint)" << std::endl;
+    ft::deque<int> dint(10, 30);
+    sint = ft::stack<int>(dint);
     std::cout << "stack is empty: " << std::boolalpha << sint.empty() << std::endl;
     std::cout << "stack size: " << sint.size() << std::endl;
     std::cout << "stack top: " << sint.top() << std::endl << std::endl;
@@ -67,4 +67,11 @@ void    stack_test(void)
     std::cout << "sint >= sint_2: " << std::boolalpha << (sint >= sint_2) << std::endl;
     std::cout << "sint < sint_2: " << std::boolalpha << (sint < sint_2) << std::endl;
     std::cout << "sint <= sint_2: " << std::boolalpha << (sint <= sint_2) << std::endl;
+
+    std::cout << std::endl << "stack on ft::vector: ft::stack<int, ft::vector<int> > svec" << std::endl;
+    ft::stack<int, ft::vector<int> > svec;
+    svec.push(1);
+    svec.push(2);
+    std::cout << "stack size: " << svec.size() << std::endl;
+    std::cout << "stack top: " << svec.top() << std::endl << std::endl;
 }
@@ -0,0 +1,103 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <string>
+#include <vector.hpp>
+
+//4 KB element, like Buffer in main.cpp.
+struct BenchPage
+{
+    int     idx;
+    char    buff[4092];
+};
+
+void    vector_bench(void)
+{
+    const int   ticks = 200000;
+    const int   count = 1024;
+    double      start;
+    size_t      allocs;
+
+    std::cout << "### copy assignment of equal-sized vectors: " << count
+        << " elements" << std::endl;
+    {
+        ft::vector<int> front(count, 1);
+        ft::vector<int> back(count, 2);
+        allocs = bench_allocs();
+        start = bench_now();
+        for (int i = 0; i < ticks; i++)
+        {
+            front[i % count] = i;
+            back = front;
+        }
+        bench_report("ft::vector<int>::operator=", ticks, bench_now() - start,
+            bench_allocs() - allocs);
+        bench_keep(back[0]);
+    }
+    {
+        ft::vector<std::string> front(count / 16, std::string(32, 'f'));
+        ft::vector<std::string> back(count / 16, std::string(32, 'b'));
+        allocs = bench_allocs();
+        start = bench_now();
+        for (int i = 0; i < ticks / 16; i++)
+            back = front;
+        bench_report("ft::vector<std::string(32)>::operator=, 64 elements",
+            ticks / 16, bench_now() - start, bench_allocs() - allocs);
+        bench_keep(back.size());
+    }
+    std::cout << std::endl;
+
+    const size_t    ints = 1 << 24;
+    const size_t    pages = 1 << 15;
+
+    std::cout << "### sizing " << ints << " ints / " << pages
+        << " 4 KB pages (time of the sizing only)" << std::endl;
+    {
+        ft::vector<int> v;
+        allocs = bench_allocs();
+        start = bench_now();
+        for (size_t i = 0; i < ints; i++)
+            v.push_back(0);
+        bench_report("ft::vector<int> push_back loop", ints,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(v.size());
+    }
+    {
+        ft::vector<int> v;
+        allocs = bench_allocs();
+        start = bench_now();
+        v.resize(ints);
+        bench_report("ft::vector<int>::resize", ints,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(v.size());
+    }
+    {
+        ft::vector<int> v;
+        allocs = bench_allocs();
+        start = bench_now();
+        v.resize_default_init(ints);
+        bench_report("ft::vector<int>::resize_default_init", ints,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(v.size());
+    }
+    {
+        ft::vector<BenchPage> v;
+        allocs = bench_allocs();
+        start = bench_now();
+        v.resize(pages);
+        bench_report("ft::vector<BenchPage>::resize", pages,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(v.size());
+    }
+    {
+        ft::vector<BenchPage> v;
+        allocs = bench_allocs();
+        start = bench_now();
+        v.resize_default_init(pages);
+        bench_report("ft::vector<BenchPage>::resize_default_init", pages,
+            bench_now() - start, bench_allocs() - allocs);
+        bench_keep(v.size());
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,73 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <vector.hpp>
+
+void    vector_bool_bench(void)
+{
+    const size_t    flags = 256 * 1024 * 1024;
+    const int       rounds = 5;
+    double          start;
+
+    std::cout << "### vector<bool> vs vector<char>, " << flags << " flags"
+        << std::endl;
+    ft::vector<char> bytes(flags, 0);
+    ft::vector<bool> a(flags, false);
+    ft::vector<bool> b(flags, false);
+    for (size_t i = 0; i < flags; i += 3)
+    {
+        bytes[i] = 1;
+        a[i] = true;
+    }
+    for (size_t i = 0; i < flags; i += 5)
+        b[i] = true;
+    std::cout << "memory: vector<char> " << bytes.capacity() / (1024 * 1024)
+        << " MB, vector<bool> " << a.capacity() / 8 / (1024 * 1024) << " MB"
+        << std::endl;
+
+    start = bench_now();
+    for (int r = 0; r < rounds; r++)
+    {
+        size_t n = 0;
+        for (size_t i = 0; i < flags; i++)
+            n += bytes[i] != 0;
+        bench_keep(n);
+    }
+    bench_report("vector<char> count (per flag)", flags * rounds,
+        bench_now() - start, 0);
+
+    start = bench_now();
+    for (int r = 0; r < rounds; r++)
+        bench_keep(a.count());
+    bench_report("vector<bool>::count (per flag)", flags * rounds,
+        bench_now() - start, 0);
+
+    start = bench_now();
+    for (int r = 0; r < rounds; r++)
+    {
+        size_t n = 0;
+        for (size_t i = b.find_first(); i != b.npos; i = b.find_next(i))
+            n++;
+        bench_keep(n);
+    }
+    bench_report("vector<bool>::find_next walk (per flag)", flags * rounds,
+        bench_now() - start, 0);
+
+    start = bench_now();
+    for (int r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < flags; i++)
+            bytes[i] &= (i % 5 == 0);
+    }
+    bench_report("vector<char> AND loop (per flag)", flags * rounds,
+        bench_now() - start, 0);
+
+    start = bench_now();
+    for (int r = 0; r < rounds; r++)
+        a &= b;
+    bench_report("vector<bool>::operator&= (per flag)", flags * rounds,
+        bench_now() - start, 0);
+    bench_keep(a.count());
+    std::cout << std::endl;
+}
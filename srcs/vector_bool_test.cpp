@@ -0,0 +1,80 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <vector.hpp>
+
+void    printBits(const ft::vector<bool> &v, std::string name)
+{
+    std::cout << name << " (" << v.size() << "):\t";
+    for (ft::vector<bool>::const_iterator it = v.begin(); it != v.end(); ++it)
+        std::cout << *it;
+    std::cout << std::endl;
+}
+
+void    vector_bool_test(void)
+{
+    std::cout << "### FT::VECTOR<BOOL>: push_back, proxy reference" << std::endl;
+    ft::vector<bool> v;
+    for (int i = 0; i < 70; i++)
+        v.push_back(i % 3 == 0);
+    printBits(v, "v");
+    v[1] = true;
+    v[0].flip();
+    v.back() = v.front();
+    ft::vector<bool>::swap(v[2], v[3]);
+    printBits(v, "v");
+    std::cout << "sizeof words: " << v.num_words() << " words for "
+        << v.size() << " bits" << std::endl;
+
+    std::cout << "### FT::VECTOR<BOOL>: count, find_first, find_next" << std::endl;
+    std::cout << "v.count(): " << v.count() << std::endl;
+    std::cout << "set bits:\t";
+    for (size_t i = v.find_first(); i != v.npos; i = v.find_next(i))
+        std::cout << i << ", ";
+    std::cout << std::endl;
+
+    std::cout << "### FT::VECTOR<BOOL>: insert / erase / resize" << std::endl;
+    v.insert(v.begin() + 2, 3, true);
+    v.erase(v.begin() + 10, v.begin() + 40);
+    printBits(v, "v");
+    v.resize(80, true);
+    printBits(v, "v");
+    v.resize(5);
+    printBits(v, "v");
+    std::cout << "v.count(): " << v.count() << std::endl;
+
+    std::cout << "### FT::VECTOR<BOOL>: bitwise" << std::endl;
+    ft::vector<bool> a(130, false);
+    ft::vector<bool> b(130, false);
+    for (size_t i = 0; i < a.size(); i += 2)
+        a[i] = true;
+    for (size_t i = 0; i < b.size(); i += 3)
+        b[i] = true;
+    std::cout << "a & b: " << (a & b).count()
+        << ", a | b: " << (a | b).count()
+        << ", a ^ b: " << (a ^ b).count() << std::endl;
+    ft::vector<bool> c(a);
+    c.flip();
+    std::cout << "~a count: " << c.count() << ", a == c: "
+        << std::boolalpha << (a == c) << ", a == a copy: "
+        << (a == ft::vector<bool>(a)) << std::endl;
+    std::cout << "reverse first 8 of a:\t";
+    ft::vector<bool>::reverse_iterator rit = a.rbegin();
+    for (int i = 0; i < 8; i++)
+        std::cout << (*rit++ ? 1 : 0);
+    std::cout << std::endl;
+    try
+    {
+        a &= v;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,71 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <cstdio>
+#include <fcntl.h>
+#include <vector_io.hpp>
+
+void    vector_io_bench(void)
+{
+    const char      *path = "/tmp/ft_vector_io_bench.bin";
+    const size_t    size = 256 << 20;
+    const size_t    chunk = 1 << 16;
+    double          start;
+    size_t          allocs;
+    int             fd;
+
+    std::cout << "### reading a " << (size >> 20) << " MB file, "
+        << (chunk >> 10) << " KB per read (op = 1 KB)" << std::endl;
+    {
+        ft::vector<char> page(chunk, 'x');
+        fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+        for (size_t done = 0; fd >= 0 && done < size; done += chunk)
+            if (write(fd, page.data(), chunk) != static_cast<ssize_t>(chunk))
+                break;
+        if (fd < 0 || close(fd) != 0)
+        {
+            std::cout << "cannot write " << path << std::endl << std::endl;
+            return;
+        }
+    }
+    {
+        ft::vector<char> v;
+        char buf[1 << 16];
+        ssize_t got;
+        fd = open(path, O_RDONLY);
+        allocs = bench_allocs();
+        start = bench_now();
+        while ((got = read(fd, buf, chunk)) > 0)
+            v.insert(v.end(), buf, buf + got);
+        bench_report("read + vector<char>::insert(end)", size >> 10,
+            bench_now() - start, bench_allocs() - allocs);
+        close(fd);
+        bench_keep(v.size());
+    }
+    {
+        ft::vector<char> v;
+        fd = open(path, O_RDONLY);
+        allocs = bench_allocs();
+        start = bench_now();
+        ft::read_all(v, fd, chunk);
+        bench_report("ft::read_all", size >> 10,
+            bench_now() - start, bench_allocs() - allocs);
+        close(fd);
+        bench_keep(v.size());
+    }
+    {
+        ft::vector<char> v;
+        v.reserve(size);
+        fd = open(path, O_RDONLY);
+        allocs = bench_allocs();
+        start = bench_now();
+        ft::read_all(v, fd, chunk);
+        bench_report("ft::read_all, reserved", size >> 10,
+            bench_now() - start, bench_allocs() - allocs);
+        close(fd);
+        bench_keep(v.size());
+    }
+    std::remove(path);
+    std::cout << std::endl;
+}
@@ -0,0 +1,90 @@
+//
+// Created by matsony on 19.10.26.
+//
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstring>
+
+#include <vector_io.hpp>
+
+//Hands out a string a few bytes per call, like a socket would.
+struct StringReader
+{
+    const std::string   *src;
+    size_t              *pos;
+
+    ssize_t operator()(char *buf, size_t n) const
+    {
+        size_t left = src->size() - *pos;
+
+        if (n > 5)
+            n = 5;
+        if (n > left)
+            n = left;
+        std::memcpy(buf, src->data() + *pos, n);
+        *pos += n;
+        return n;
+    }
+};
+
+//Claims more bytes than it was given room for.
+static ssize_t lying_reader(char *buf, size_t n)
+{
+    buf[0] = 'x';
+    return n + 4096;
+}
+
+void    vector_io_test(void)
+{
+    std::cout << "### FT::VECTOR_IO: prepare / commit" << std::endl;
+    ft::vector<char> v;
+    char *room = v.prepare(4);
+    std::memcpy(room, "abcd", 4);
+    v.commit(3);
+    std::cout << "size: " << v.size() << ", capacity >= 4: " << std::boolalpha
+        << (v.capacity() >= 4) << ", contents: "
+        << std::string(v.data(), v.size()) << std::endl;
+
+    std::cout << "### FT::VECTOR_IO: read_into with a reader" << std::endl;
+    std::string src("hello, read_into!");
+    size_t pos = 0;
+    StringReader reader = {&src, &pos};
+    ssize_t got;
+    while ((got = ft::read_into(v, 64, reader)) > 0)
+        std::cout << got << " ";
+    std::cout << "-> " << std::string(v.data(), v.size()) << std::endl;
+
+    std::cout << "### FT::VECTOR_IO: commit past capacity" << std::endl;
+    size_t before = v.size();
+    try
+    {
+        ft::read_into(v, 8, lying_reader);
+    }
+    catch (std::length_error &e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+    std::cout << "size unchanged: " << (v.size() == before) << std::endl;
+
+    std::cout << "### FT::VECTOR_IO: read_all / as_iovec through a pipe"
+        << std::endl;
+    int fds[2];
+    if (pipe(fds) != 0)
+        return;
+    struct iovec iov[2];
+    iov[0] = ft::as_iovec(v, 3);
+    iov[1] = ft::as_iovec(v);
+    std::cout << "writev: " << writev(fds[1], iov, 2) << " bytes" << std::endl;
+    close(fds[1]);
+    ft::vector<char> in;
+    std::cout << "read_all: " << ft::read_all(in, fds[0], 7) << " bytes: "
+        << std::string(in.data(), in.size()) << std::endl;
+    close(fds[0]);
+    std::cout << "read_all on a closed fd: " << ft::read_all(in, fds[0])
+        << std::endl;
+    ft::vector<int> ints(3, 42);
+    std::cout << "as_iovec(vector<int>(3), 1).iov_len: "
+        << ft::as_iovec(ints, 1).iov_len << std::endl << std::endl;
+}
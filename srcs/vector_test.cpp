@@ -262,4 +262,67 @@ void    vector_test(void)
     vint.erase(vint.begin(), vint.end() - 3);
     printVec(vint, "vint");
 
+    std::cout << std::endl << "### FT::VECTOR: copy reuses storage" << std::endl;
+    ft::vector<Mymain> src(20, Mymain("src"));
+    src.resize(5);
+    ft::vector<Mymain> dst(src);
+    std::cout << "dst(src): size: " << dst.size() << ", capacity: "
+        << dst.capacity() << std::endl;
+    ft::vector<Mymain> big(8, Mymain("big"));
+    const Mymain *buf = &big[0];
+    big = src;
+    std::cout << "big = src: size: " << big.size() << ", capacity: "
+        << big.capacity() << ", same buffer: " << std::boolalpha
+        << (buf == &big[0]) << std::endl;
+    src.push_back(Mymain("six"));
+    src.push_back(Mymain("seven"));
+    big = src;
+    std::cout << "big = src (7): same buffer: " << (buf == &big[0])
+        << ", big[6]: " << big[6] << std::endl;
+    src.resize(10, Mymain("ten"));
+    big = src;
+    std::cout << "big = src (10): size: " << big.size() << ", capacity: "
+        << big.capacity() << ", big[9]: " << big[9] << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "### FT::VECTOR: resize" << std::endl;
+    ft::vector<int> r;
+    r.resize(3, 7);
+    printVec(r, "r.resize(3, 7)");
+    r.resize(r.capacity() + 1, r[0]);
+    std::cout << "r.resize(cap + 1, r[0]): size: " << r.size() << ", back: "
+        << r.back() << std::endl;
+    r.resize(2);
+    printVec(r, "r.resize(2)");
+    ft::vector<Mymain> rm;
+    rm.resize(2, Mymain("resized"));
+    rm.resize(3, rm[0]);
+    rm.resize(5, Mymain("five"));
+    rm.resize(4);
+    for (size_t i = 0; i < rm.size(); i++)
+        std::cout << rm[i] << " ";
+    std::cout << std::endl;
+
+    std::cout << "### FT::VECTOR: push_back(v[0]) at full capacity" << std::endl;
+    ft::vector<Mymain> pb(1, Mymain("front"));
+    while (pb.size() < pb.capacity())
+        pb.push_back(Mymain("fill"));
+    size_t full = pb.capacity();
+    pb.push_back(pb[0]);
+    std::cout << "grew: " << (pb.capacity() > full) << ", back: " << pb.back()
+        << std::endl;
+
+    std::cout << "### FT::VECTOR: resize_default_init" << std::endl;
+    ft::vector<int> d(2, 5);
+    d.resize_default_init(1000);
+    for (size_t i = 2; i < d.size(); i++)
+        d[i] = static_cast<int>(i);
+    std::cout << "d: size: " << d.size() << ", d[0]: " << d[0] << ", d[999]: "
+        << d[999] << std::endl;
+    d.resize_default_init(1);
+    printVec(d, "d.resize_default_init(1)");
+    ft::vector<std::string> ds(1, "kept");
+    ds.resize_default_init(3);
+    std::cout << "ds: " << ds[0] << ", '" << ds[1] << "', '" << ds[2] << "'"
+        << std::endl << std::endl;
 }